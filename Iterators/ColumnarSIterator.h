@@ -0,0 +1,186 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+
+/**
+ * Proxy returned by the iterators of ColumnarSListArray: a std::tuple of references to the fields of an element, one in each column.
+ *
+ * It only adds the specializations letting std::ranges find a common reference between it and the std::tuple of values,
+ * which std::tuple alone gets since C++23: without them, its iterators wouldn't model std::forward_iterator.
+ *
+ * @see ColumnarSIterator
+ */
+template<typename... References>
+class ColumnarSRecord : public std::tuple<References...>
+{
+public:
+
+	using std::tuple<References...>::tuple;
+};
+
+namespace std
+{
+	template<typename... References>
+	struct tuple_size<ColumnarSRecord<References...>> : std::integral_constant<std::size_t, sizeof...(References)> { };
+
+	template<std::size_t Field, typename... References>
+	struct tuple_element<Field, ColumnarSRecord<References...>> : std::tuple_element<Field, std::tuple<References...>> { };
+
+	// Both a record and a tuple of values convert to a record of const references.
+	template<typename... References, typename... Values, template<typename> class RecordQualifiers, template<typename> class TupleQualifiers>
+	struct basic_common_reference<ColumnarSRecord<References...>, std::tuple<Values...>, RecordQualifiers, TupleQualifiers>
+	{
+		using type = ColumnarSRecord<const Values&...>;
+	};
+
+	template<typename... Values, typename... References, template<typename> class TupleQualifiers, template<typename> class RecordQualifiers>
+	struct basic_common_reference<std::tuple<Values...>, ColumnarSRecord<References...>, TupleQualifiers, RecordQualifiers>
+	{
+		using type = ColumnarSRecord<const Values&...>;
+	};
+}
+
+
+
+/**
+ * Forward iterator used in conjunction with ColumnarSListArray.
+ *
+ * Just like SIteratorArray, it uses the index of the iterated element, decrementing it when incrementing the iterator,
+ * but along with a pointer to each of the list's columns, one per field.
+ * Elements aren't stored as a whole anywhere, so it returns them through a proxy, ColumnarSRecord: a tuple of references to their fields, one in each column.
+ * Structured bindings unpack it, and only the fields actually read are loaded.
+ *
+ * Even though it doesn't use the keyword const, this is treated as a constant iterator, and as such it does not modify its values.
+ *
+ * @see ColumnarSListArray, SIteratorArray
+ */
+template<typename... Fields>
+class ConstColumnarSIterator
+{
+protected:
+
+	using Index = long long int; // Not unsigned, because we need -1 as a valid index for an invalid iterator.
+	using Columns = std::tuple<Fields*...>;
+
+public:
+
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = std::tuple<Fields...>;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = void;
+	using reference         = ColumnarSRecord<const Fields&...>;
+
+
+	ConstColumnarSIterator() = default;
+
+	inline ConstColumnarSIterator(Columns Data, Index DataPointed)
+		: m_Columns(Data), m_DataPointed(DataPointed) { }
+
+	ConstColumnarSIterator(const ConstColumnarSIterator<Fields...>& That) = default;
+	~ConstColumnarSIterator() = default;
+
+
+	ConstColumnarSIterator<Fields...>& operator= (const ConstColumnarSIterator<Fields...>& That) = default;
+
+	// Every column belongs to the same list, so comparing the first one is enough.
+	inline bool operator== (const ConstColumnarSIterator<Fields...>& That) const
+	{
+		return (std::get<0>(m_Columns) == std::get<0>(That.m_Columns)) &&
+			   (m_DataPointed == That.m_DataPointed);
+	}
+
+	inline bool operator!= (const ConstColumnarSIterator<Fields...>& That) const
+	{
+		return ! operator==(That);
+	}
+
+
+	inline ColumnarSRecord<const Fields&...> operator* () const
+	{
+		return std::apply([this](Fields*... Column) { return ColumnarSRecord<const Fields&...>(Column[m_DataPointed]...); }, m_Columns);
+	}
+
+	// Reads a single field of the iterated element, without building the whole proxy.
+	template<std::size_t Field>
+	inline const auto& get() const { return std::get<Field>(m_Columns)[m_DataPointed]; }
+
+
+	inline ConstColumnarSIterator<Fields...>& operator++()
+	{
+		--m_DataPointed;
+		return *this;
+	}
+
+	inline ConstColumnarSIterator<Fields...> operator++(int)
+	{
+		ConstColumnarSIterator<Fields...> OldIter(*this);
+		operator++();
+		return OldIter;
+	}
+
+
+protected:
+
+	Columns m_Columns = Columns();
+	Index m_DataPointed = 0;
+};
+
+
+
+/**
+ * Forward iterator used in conjunction with ColumnarSListArray.
+ *
+ * It extends ConstColumnarSIterator, allowing for its values to be modified through the references of its proxy.
+ *
+ * @see ColumnarSListArray, ConstColumnarSIterator
+ */
+template<typename... Fields>
+class ColumnarSIterator : public ConstColumnarSIterator<Fields...>
+{
+	using ConstColumnarSIterator<Fields...>::m_Columns;
+	using ConstColumnarSIterator<Fields...>::m_DataPointed;
+	using typename ConstColumnarSIterator<Fields...>::Columns;
+	using typename ConstColumnarSIterator<Fields...>::Index;
+
+public:
+
+	using reference = ColumnarSRecord<Fields&...>;
+
+
+	ColumnarSIterator() : ConstColumnarSIterator<Fields...>() { }
+	inline ColumnarSIterator(Columns Data, Index DataPointed) : ConstColumnarSIterator<Fields...>(Data, DataPointed) { }
+	inline ColumnarSIterator(const ConstColumnarSIterator<Fields...>& That) : ConstColumnarSIterator<Fields...>(That) { }
+	~ColumnarSIterator() = default;
+
+
+	// Const, just like the std iterators: constness of the iterator doesn't apply to the iterated values.
+	inline ColumnarSRecord<Fields&...> operator* () const
+	{
+		return std::apply([this](Fields*... Column) { return ColumnarSRecord<Fields&...>(Column[m_DataPointed]...); }, m_Columns);
+	}
+
+	template<std::size_t Field>
+	inline auto& get() const { return std::get<Field>(m_Columns)[m_DataPointed]; }
+
+
+	// Returning the derived type, they let it model std::forward_iterator, so it can be used with std::ranges.
+
+	inline ColumnarSIterator<Fields...>& operator++()
+	{
+		ConstColumnarSIterator<Fields...>::operator++();
+		return *this;
+	}
+
+	inline ColumnarSIterator<Fields...> operator++(int)
+	{
+		ColumnarSIterator<Fields...> OldIter(*this);
+		ConstColumnarSIterator<Fields...>::operator++();
+		return OldIter;
+	}
+};
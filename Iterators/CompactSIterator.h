@@ -0,0 +1,140 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include "CompactSNode.h"
+#include <cstddef>
+#include <iterator>
+
+
+/**
+ * Forward iterator used in conjunction with CompactSList.
+ *
+ * It uses a pointer to the slab of CompactSNodes and the index of the iterated node, following the nodes' Next indices.
+ * end() iterators have CompactSNode::NullIndex as their index.
+ *
+ * Just like std::vector's iterators, it is invalidated when the slab grows.
+ *
+ * Even though it doesn't use the keyword const, this is treated as a constant iterator, and as such it does not modify its values.
+ *
+ * @see CompactSList, CompactSNode
+ */
+template<typename T>
+class ConstCompactSIterator
+{
+protected:
+
+	using Index = typename CompactSNode<T>::index_type;
+	using NodeArray = CompactSNode<T>*;
+
+public:
+
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = T*;
+	using reference         = T&;
+
+
+	ConstCompactSIterator() = default;
+
+	inline ConstCompactSIterator(NodeArray Nodes, Index NodePointed)
+		: m_Nodes(Nodes), m_NodePointed(NodePointed) { }
+
+	inline ConstCompactSIterator(const ConstCompactSIterator<T>& That)
+		: m_Nodes(That.m_Nodes), m_NodePointed(That.m_NodePointed) { }
+
+	~ConstCompactSIterator() = default;
+
+
+	inline ConstCompactSIterator<T>& operator= (const ConstCompactSIterator<T>& That)
+	{
+		m_Nodes = That.m_Nodes;
+		m_NodePointed = That.m_NodePointed;
+		return *this;
+	}
+
+	inline bool operator== (const ConstCompactSIterator<T>& That) const
+	{
+		return (m_Nodes == That.m_Nodes) &&
+			   (m_NodePointed == That.m_NodePointed);
+	}
+
+	inline bool operator!= (const ConstCompactSIterator<T>& That) const
+	{
+		return ! operator==(That);
+	}
+
+
+	inline const T& operator* () const { return m_Nodes[m_NodePointed].Data; }
+	inline const T* operator-> () const { return &(m_Nodes[m_NodePointed].Data); }
+
+
+	inline ConstCompactSIterator<T>& operator++()
+	{
+		m_NodePointed = m_Nodes[m_NodePointed].Next;
+		return *this;
+	}
+
+	inline ConstCompactSIterator<T> operator++(int)
+	{
+		ConstCompactSIterator<T> OldIter(*this);
+		operator++();
+		return OldIter;
+	}
+
+
+protected:
+
+	NodeArray m_Nodes = nullptr;
+	Index m_NodePointed = CompactSNode<T>::NullIndex;
+};
+
+
+
+/**
+ * Forward iterator used in conjunction with CompactSList.
+ *
+ * It uses a pointer to the slab of CompactSNodes and the index of the iterated node, following the nodes' Next indices.
+ * end() iterators have CompactSNode::NullIndex as their index.
+ *
+ * It extends ConstCompactSIterator, allowing for its values to be modified.
+ *
+ * @see CompactSList, CompactSNode
+ */
+template<typename T>
+class CompactSIterator : public ConstCompactSIterator<T>
+{
+	using ConstCompactSIterator<T>::m_Nodes;
+	using ConstCompactSIterator<T>::m_NodePointed;
+	using typename ConstCompactSIterator<T>::NodeArray;
+	using typename ConstCompactSIterator<T>::Index;
+
+public:
+
+	inline CompactSIterator() : ConstCompactSIterator<T>() { }
+	inline CompactSIterator(NodeArray Nodes, Index NodePointed) : ConstCompactSIterator<T>(Nodes, NodePointed) { }
+	inline CompactSIterator(const ConstCompactSIterator<T>& That) : ConstCompactSIterator<T>(That) { }
+	~CompactSIterator() = default;
+
+
+	// Const, just like the std iterators: constness of the iterator doesn't apply to the iterated values.
+	inline T& operator* () const { return m_Nodes[m_NodePointed].Data; }
+	inline T* operator-> () const { return &(m_Nodes[m_NodePointed].Data); }
+
+
+	// Returning the derived type, they let it model std::forward_iterator, so it can be used with std::ranges.
+
+	inline CompactSIterator<T>& operator++()
+	{
+		ConstCompactSIterator<T>::operator++();
+		return *this;
+	}
+
+	inline CompactSIterator<T> operator++(int)
+	{
+		CompactSIterator<T> OldIter(*this);
+		ConstCompactSIterator<T>::operator++();
+		return OldIter;
+	}
+};
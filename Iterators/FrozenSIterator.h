@@ -0,0 +1,112 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include "FrozenSBlock.h"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+
+/**
+ * Forward iterator used in conjunction with FrozenSList.
+ *
+ * It uses pointers to the list's blocks and packed words, and the index of the iterated element, keeping the decoded value of the element:
+ * advancing reads the next difference of the current block and adds it, or loads the first value of the next block.
+ * The blocks always end with an empty one, so iterators reaching the end of the list don't need to know its size.
+ *
+ * Elements are decoded on the fly, so it returns them by value, and it doesn't provide operator->.
+ * There isn't a non const version, since FrozenSLists can't be modified.
+ *
+ * @see FrozenSList, FrozenSBlock
+ */
+template<typename T>
+class ConstFrozenSIterator
+{
+	using Block = FrozenSBlock<T>;
+	using Word = typename Block::Word;
+
+public:
+
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = void;
+	using reference         = T;
+
+
+	ConstFrozenSIterator() = default;
+
+	// Index must be the first element of a block, or the size of the list.
+	inline ConstFrozenSIterator(const Block* Blocks, const Word* Words, std::size_t Index)
+		: m_Blocks(Blocks), m_Words(Words), m_Index(Index)
+	{
+		LoadBlock();
+	}
+
+	ConstFrozenSIterator(const ConstFrozenSIterator<T>& That) = default;
+	~ConstFrozenSIterator() = default;
+
+
+	ConstFrozenSIterator<T>& operator= (const ConstFrozenSIterator<T>& That) = default;
+
+	inline bool operator== (const ConstFrozenSIterator<T>& That) const
+	{
+		return (m_Blocks == That.m_Blocks) &&
+			   (m_Index == That.m_Index);
+	}
+
+	inline bool operator!= (const ConstFrozenSIterator<T>& That) const
+	{
+		return ! operator==(That);
+	}
+
+
+	inline T operator* () const { return m_Value; }
+
+
+	inline ConstFrozenSIterator<T>& operator++()
+	{
+		++m_Index;
+
+		if (m_Index % Block::Size == 0)
+		{
+			LoadBlock();
+		}
+		else
+		{
+			m_Value = Block::Decode(m_Value, Block::Read(m_Words, m_BitPosition, m_Mask));
+			m_BitPosition += m_Width;
+		}
+
+		return *this;
+	}
+
+	inline ConstFrozenSIterator<T> operator++(int)
+	{
+		ConstFrozenSIterator<T> OldIter(*this);
+		operator++();
+		return OldIter;
+	}
+
+
+private:
+
+	inline void LoadBlock()
+	{
+		const Block& Current = m_Blocks[m_Index / Block::Size];
+
+		m_Value = Current.First;
+		m_BitPosition = Current.BitOffset;
+		m_Width = Current.Width;
+		m_Mask = Block::Mask(Current.Width);
+	}
+
+	const Block* m_Blocks = nullptr;
+	const Word* m_Words = nullptr;
+	std::size_t m_Index = 0;
+	T m_Value = T();
+	std::uint64_t m_BitPosition = 0;
+	Word m_Mask = 0;
+	unsigned int m_Width = 0;
+};
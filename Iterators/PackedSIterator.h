@@ -0,0 +1,172 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include "PackedWords.h"
+
+
+/**
+ * Proxy reference to an element of a packed list, returned by PackedSIterator and by the packed lists' non const front().
+ *
+ * Elements are only a few bits of a word, so they can't be referenced directly: the proxy reads them when converted to T, and writes them when assigned.
+ * Assignment is const, just like for the iterators: constness of the proxy doesn't apply to the referenced element.
+ *
+ * @see PackedSIterator, PackedWords
+ */
+template<typename T, unsigned Bits>
+class PackedSReference
+{
+	using Words = PackedWords<T, Bits>;
+
+public:
+
+	constexpr PackedSReference(typename Words::Word* Data, typename Words::Index Position) : m_Data(Data), m_Position(Position) { }
+	constexpr PackedSReference(const PackedSReference<T, Bits>& That) = default;
+
+
+	constexpr operator T() const { return Words::Get(m_Data, m_Position); }
+
+	constexpr const PackedSReference<T, Bits>& operator= (const T& Value) const
+	{
+		Words::Set(m_Data, m_Position, Value);
+		return *this;
+	}
+
+	// Copies the referenced value, not the reference.
+	constexpr const PackedSReference<T, Bits>& operator= (const PackedSReference<T, Bits>& That) const { return operator=(static_cast<T>(That)); }
+
+private:
+
+	typename Words::Word* m_Data;
+	typename Words::Index m_Position;
+};
+
+
+
+/**
+ * Forward iterator used in conjunction with PackedSListArray and PackedFixedSList.
+ *
+ * It uses a pointer to the packed words and the index of the iterated element, extracting its bits to retrieve it.
+ *
+ * Just like SIteratorArray, it assumes that the last element has the index 0, and as such it actually decrements the index when incrementing the iterator.
+ *
+ * Elements don't have an address of their own, so it returns them by value, and it doesn't provide operator->.
+ * Even though it doesn't use the keyword const, this is treated as a constant iterator, and as such it does not modify its values.
+ *
+ * @see PackedSListArray, PackedFixedSList
+ */
+template<typename T, unsigned Bits>
+class ConstPackedSIterator
+{
+protected:
+
+	using Words = PackedWords<T, Bits>;
+	using Index = typename Words::Index; // Not unsigned, because we need -1 as a valid index for an invalid iterator.
+	using DataArray = typename Words::Word*;
+
+public:
+
+	// std::iterator is deprecated since C++17, so the iterator traits are declared by hand.
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = void;
+	using reference         = T;
+
+
+	constexpr ConstPackedSIterator() = default;
+
+	constexpr ConstPackedSIterator(DataArray Data, Index DataPointed)
+		: m_Data(Data), m_DataPointed(DataPointed) { }
+
+	constexpr ConstPackedSIterator(const ConstPackedSIterator<T, Bits>& That) = default;
+	constexpr ~ConstPackedSIterator() = default;
+
+
+	constexpr ConstPackedSIterator<T, Bits>& operator= (const ConstPackedSIterator<T, Bits>& That) = default;
+
+	constexpr bool operator== (const ConstPackedSIterator<T, Bits>& That) const
+	{
+		return (m_Data == That.m_Data) &&
+			   (m_DataPointed == That.m_DataPointed);
+	}
+
+	constexpr bool operator!= (const ConstPackedSIterator<T, Bits>& That) const
+	{
+		return ! operator==(That);
+	}
+
+
+	constexpr T operator* () const { return Words::Get(m_Data, m_DataPointed); }
+
+
+	constexpr ConstPackedSIterator<T, Bits>& operator++()
+	{
+		// Why decrement? Read the javadoc.
+		--m_DataPointed;
+		return *this;
+	}
+
+	constexpr ConstPackedSIterator<T, Bits> operator++(int)
+	{
+		ConstPackedSIterator<T, Bits> OldIter(*this);
+		operator++();
+		return OldIter;
+	}
+
+
+protected:
+
+	DataArray m_Data = nullptr;
+	Index m_DataPointed = 0;
+};
+
+
+
+/**
+ * Forward iterator used in conjunction with PackedSListArray and PackedFixedSList.
+ *
+ * It extends ConstPackedSIterator, allowing for its values to be modified through a PackedSReference proxy.
+ *
+ * @see PackedSListArray, PackedFixedSList, PackedSReference
+ */
+template<typename T, unsigned Bits>
+class PackedSIterator : public ConstPackedSIterator<T, Bits>
+{
+	using ConstPackedSIterator<T, Bits>::m_Data;
+	using ConstPackedSIterator<T, Bits>::m_DataPointed;
+	using typename ConstPackedSIterator<T, Bits>::DataArray;
+	using typename ConstPackedSIterator<T, Bits>::Index;
+
+public:
+
+	using reference = PackedSReference<T, Bits>;
+
+
+	constexpr PackedSIterator() : ConstPackedSIterator<T, Bits>() { }
+	constexpr PackedSIterator(DataArray Data, Index DataPointed) : ConstPackedSIterator<T, Bits>(Data, DataPointed) { }
+	constexpr PackedSIterator(const ConstPackedSIterator<T, Bits>& That) : ConstPackedSIterator<T, Bits>(That) { }
+	constexpr ~PackedSIterator() = default;
+
+
+	// Const, just like the std iterators: constness of the iterator doesn't apply to the iterated values.
+	constexpr reference operator* () const { return reference(m_Data, m_DataPointed); }
+
+
+	// Returning the derived type, they let it model std::forward_iterator, so it can be used with std::ranges.
+
+	constexpr PackedSIterator<T, Bits>& operator++()
+	{
+		ConstPackedSIterator<T, Bits>::operator++();
+		return *this;
+	}
+
+	constexpr PackedSIterator<T, Bits> operator++(int)
+	{
+		PackedSIterator<T, Bits> OldIter(*this);
+		ConstPackedSIterator<T, Bits>::operator++();
+		return OldIter;
+	}
+};
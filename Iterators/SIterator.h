@@ -3,6 +3,7 @@
 #pragma once
 
 #include "SNode.h"
+#include <cstddef>
 #include <iterator>
 
 
@@ -14,31 +15,41 @@
  * 
  * Even though it doesn't use the keyword const, this is treated as a constant iterator, and as such it does not modify its values.
  *
- * @see SList, SNode
+ * NodeType can be replaced by any node type exposing the same Next and Data members of SNode, like SharedSNode.
+ *
+ * @see SList, SNode, SharedSNode
  */
-template<typename T>
-class ConstSIterator : public std::iterator<std::forward_iterator_tag, SNode<T>>
+template<typename T, typename NodeType = SNode<T>>
+class ConstSIterator
 {
 public:
 
+	// std::iterator is deprecated since C++17, so the iterator traits are declared by hand.
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = T*;
+	using reference         = T&;
+
+
 	ConstSIterator() = default;
-	inline ConstSIterator(SNode<T>* Node) : m_NodePointed(Node) { }
-	inline ConstSIterator(const ConstSIterator<T>& That) : m_NodePointed(That.m_NodePointed) { }
+	inline ConstSIterator(NodeType* Node) : m_NodePointed(Node) { }
+	inline ConstSIterator(const ConstSIterator<T, NodeType>& That) : m_NodePointed(That.m_NodePointed) { }
 	~ConstSIterator() = default;
 
-	inline ConstSIterator<T>& operator= (const ConstSIterator<T>& That)
+	inline ConstSIterator<T, NodeType>& operator= (const ConstSIterator<T, NodeType>& That)
 	{
 		m_NodePointed = That.m_NodePointed;
 		return *this;
 	}
 
-	inline bool operator== (const ConstSIterator<T>& That) const
+	inline bool operator== (const ConstSIterator<T, NodeType>& That) const
 	{
 		return m_NodePointed == That.m_NodePointed;
 	}
 
 	// Non-canonical implementation of operator!=, given its brevity it isn't a concern.
-	inline bool operator!= (const ConstSIterator<T>& That) const
+	inline bool operator!= (const ConstSIterator<T, NodeType>& That) const
 	{
 		return m_NodePointed != That.m_NodePointed;
 	}
@@ -48,23 +59,27 @@ public:
 	inline const T* operator-> () const { return &(m_NodePointed->Data); }
 
 
-	inline ConstSIterator<T>& operator++()
+	inline ConstSIterator<T, NodeType>& operator++()
 	{
-		m_NodePointed = m_NodePointed->Next;
+		// SNode's Next is an SListLink, shared by every SNode type: the cast gives it back its type.
+		m_NodePointed = static_cast<NodeType*>(m_NodePointed->Next);
 		return *this;
 	}
 
-	inline ConstSIterator<T> operator++(int)
+	inline ConstSIterator<T, NodeType> operator++(int)
 	{
-		ConstSIterator<T> OldIter(*this);
+		ConstSIterator<T, NodeType> OldIter(*this);
 		operator++();
 		return OldIter;
 	}
 
+	// Exposes the iterated node, so that lists can implement operations taking a position, like erase_after().
+	inline NodeType* node() const { return m_NodePointed; }
+
 
 protected:
 
-	SNode<T>* m_NodePointed = nullptr;
+	NodeType* m_NodePointed = nullptr;
 };
 
 
@@ -92,6 +107,23 @@ public:
 	~SIterator() = default;
 
 
-	inline T& operator* () { return m_NodePointed->Data; }
-	inline T* operator-> () { return &(m_NodePointed->Data); }
+	// Const, just like the std iterators: constness of the iterator doesn't apply to the iterated values.
+	inline T& operator* () const { return m_NodePointed->Data; }
+	inline T* operator-> () const { return &(m_NodePointed->Data); }
+
+
+	// Returning the derived type, they let it model std::forward_iterator, so it can be used with std::ranges.
+
+	inline SIterator<T>& operator++()
+	{
+		ConstSIterator<T>::operator++();
+		return *this;
+	}
+
+	inline SIterator<T> operator++(int)
+	{
+		SIterator<T> OldIter(*this);
+		ConstSIterator<T>::operator++();
+		return OldIter;
+	}
 };
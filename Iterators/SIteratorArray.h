@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iterator>
 
 
@@ -21,7 +22,7 @@
  * @see SListArray, FixedSList
  */
 template<typename T>
-class ConstSIteratorArray : public std::iterator<std::forward_iterator_tag, T>
+class ConstSIteratorArray
 {
 protected:
 
@@ -30,48 +31,56 @@ protected:
 
 public:
 
-	ConstSIteratorArray() = default;
+	// std::iterator is deprecated since C++17, so the iterator traits are declared by hand.
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = T*;
+	using reference         = T&;
 
-	inline ConstSIteratorArray(DataArray Data, Index DataPointed)
+
+	constexpr ConstSIteratorArray() = default;
+
+	constexpr ConstSIteratorArray(DataArray Data, Index DataPointed)
 		: m_Data(Data), m_DataPointed(DataPointed) { }
 
-	inline ConstSIteratorArray(const ConstSIteratorArray<T>& That)
+	constexpr ConstSIteratorArray(const ConstSIteratorArray<T>& That)
 		: m_Data(That.m_Data), m_DataPointed(That.m_DataPointed) { }
 
-	~ConstSIteratorArray() = default;
+	constexpr ~ConstSIteratorArray() = default;
 
 
-	inline ConstSIteratorArray<T>& operator= (const ConstSIteratorArray<T>& That)
+	constexpr ConstSIteratorArray<T>& operator= (const ConstSIteratorArray<T>& That)
 	{
 		m_Data = That.m_Data;
 		m_DataPointed = That.m_DataPointed;
 		return *this;
 	}
 
-	inline bool operator== (const ConstSIteratorArray<T>& That) const
+	constexpr bool operator== (const ConstSIteratorArray<T>& That) const
 	{
 		return (m_Data == That.m_Data) &&
 			   (m_DataPointed == That.m_DataPointed);
 	}
 
-	inline bool operator!= (const ConstSIteratorArray<T>& That) const
+	constexpr bool operator!= (const ConstSIteratorArray<T>& That) const
 	{
 		return ! operator==(That);
 	}
 
 
-	inline const T& operator* () const { return m_Data[m_DataPointed]; }
-	inline const T* operator-> () const { return &(m_Data[m_DataPointed]); }
+	constexpr const T& operator* () const { return m_Data[m_DataPointed]; }
+	constexpr const T* operator-> () const { return &(m_Data[m_DataPointed]); }
 
 
-	inline ConstSIteratorArray<T>& operator++()
+	constexpr ConstSIteratorArray<T>& operator++()
 	{
 		// Why decrement? Read the javadoc.
 		--m_DataPointed;
 		return *this;
 	}
 
-	inline ConstSIteratorArray<T> operator++(int)
+	constexpr ConstSIteratorArray<T> operator++(int)
 	{
 		ConstSIteratorArray<T> OldIter(*this);
 		operator++();
@@ -107,17 +116,34 @@ class SIteratorArray : public ConstSIteratorArray<T>
 {
 	using ConstSIteratorArray<T>::m_Data;
 	using ConstSIteratorArray<T>::m_DataPointed;
-	using ConstSIteratorArray<T>::DataArray;
-	using ConstSIteratorArray<T>::Index;
+	using typename ConstSIteratorArray<T>::DataArray;
+	using typename ConstSIteratorArray<T>::Index;
 
 public:
 
-	inline SIteratorArray() : ConstSIteratorArray<T>() { }
-	inline SIteratorArray(DataArray Data, Index DataPointed) : ConstSIteratorArray<T>(Data, DataPointed) { }
-	inline SIteratorArray(const ConstSIteratorArray<T>& That) : ConstSIteratorArray<T>(That) { }
-	~SIteratorArray() = default;
+	constexpr SIteratorArray() : ConstSIteratorArray<T>() { }
+	constexpr SIteratorArray(DataArray Data, Index DataPointed) : ConstSIteratorArray<T>(Data, DataPointed) { }
+	constexpr SIteratorArray(const ConstSIteratorArray<T>& That) : ConstSIteratorArray<T>(That) { }
+	constexpr ~SIteratorArray() = default;
+
+
+	// Const, just like the std iterators: constness of the iterator doesn't apply to the iterated values.
+	constexpr T& operator* () const { return m_Data[m_DataPointed]; }
+	constexpr T* operator-> () const { return &(m_Data[m_DataPointed]); }
+
+
+	// Returning the derived type, they let it model std::forward_iterator, so it can be used with std::ranges.
 
+	constexpr SIteratorArray<T>& operator++()
+	{
+		ConstSIteratorArray<T>::operator++();
+		return *this;
+	}
 
-	inline T& operator* () { return m_Data[m_DataPointed]; }
-	inline T* operator-> () { return &(m_Data[m_DataPointed]); }
+	constexpr SIteratorArray<T> operator++(int)
+	{
+		SIteratorArray<T> OldIter(*this);
+		ConstSIteratorArray<T>::operator++();
+		return OldIter;
+	}
 };
@@ -0,0 +1,139 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+
+/**
+ * Lazy, non owning views over the lists, built on C++20 ranges.
+ *
+ * Every list iterator models std::forward_iterator, so the lists are ranges themselves, and any std::views adaptor can be applied to them:
+ * filter, transform, take and drop are exposed here too, next to all(), which views a const list through its const iterators,
+ * and zip(), which C++20 doesn't provide yet.
+ *
+ * Adaptors only wrap the iterators of the previous stage, so a whole pipeline runs in a single pass, without storing any intermediate result.
+ * Nothing is stored at all until to() materializes the pipeline into a list, building it through its range constructor in one go.
+ *
+ * Just like any other view, they must not outlive the lists they view.
+ *
+ * @see SIterator, SIteratorArray
+ */
+namespace SListViews
+{
+	inline constexpr auto filter = std::views::filter;
+	inline constexpr auto transform = std::views::transform;
+	inline constexpr auto take = std::views::take;
+	inline constexpr auto drop = std::views::drop;
+
+
+	// Views List through its const iterators, since not every list has a const begin().
+	template<typename ListType>
+	inline auto all(const ListType& List) { return std::ranges::subrange(List.cbegin(), List.cend()); }
+
+
+	/**
+	 * View pairing the elements of two ranges with the same position, up to the end of the shortest one.
+	 * Its elements are std::pairs of the references returned by the two ranges' iterators, so they're never copied.
+	 */
+	template<std::ranges::forward_range FirstRange, std::ranges::forward_range SecondRange>
+		requires std::ranges::view<FirstRange> && std::ranges::view<SecondRange>
+	class ZipView : public std::ranges::view_interface<ZipView<FirstRange, SecondRange>>
+	{
+		using FirstIterator = std::ranges::iterator_t<FirstRange>;
+		using SecondIterator = std::ranges::iterator_t<SecondRange>;
+
+	public:
+
+		class Sentinel;
+
+		class Iterator
+		{
+		public:
+
+			using iterator_category = std::forward_iterator_tag;
+			using value_type        = std::pair<std::iter_reference_t<FirstIterator>, std::iter_reference_t<SecondIterator>>;
+			using difference_type   = std::ptrdiff_t;
+
+
+			Iterator() = default;
+			inline Iterator(FirstIterator First, SecondIterator Second) : m_First(std::move(First)), m_Second(std::move(Second)) { }
+
+			// Both iterators always advance together, so comparing the first one is enough.
+			inline bool operator== (const Iterator& That) const { return m_First == That.m_First; }
+
+			inline value_type operator* () const { return value_type(*m_First, *m_Second); }
+
+			inline Iterator& operator++()
+			{
+				++m_First;
+				++m_Second;
+				return *this;
+			}
+
+			inline Iterator operator++(int)
+			{
+				Iterator OldIter(*this);
+				operator++();
+				return OldIter;
+			}
+
+		private:
+
+			friend class Sentinel;
+
+			FirstIterator m_First;
+			SecondIterator m_Second;
+		};
+
+		class Sentinel
+		{
+		public:
+
+			Sentinel() = default;
+			inline Sentinel(std::ranges::sentinel_t<FirstRange> FirstEnd, std::ranges::sentinel_t<SecondRange> SecondEnd)
+				: m_FirstEnd(std::move(FirstEnd)), m_SecondEnd(std::move(SecondEnd)) { }
+
+			inline bool operator== (const Iterator& It) const { return It.m_First == m_FirstEnd || It.m_Second == m_SecondEnd; }
+
+		private:
+
+			std::ranges::sentinel_t<FirstRange> m_FirstEnd;
+			std::ranges::sentinel_t<SecondRange> m_SecondEnd;
+		};
+
+
+		ZipView() = default;
+		inline ZipView(FirstRange First, SecondRange Second) : m_First(std::move(First)), m_Second(std::move(Second)) { }
+
+		inline Iterator begin() { return Iterator(std::ranges::begin(m_First), std::ranges::begin(m_Second)); }
+		inline Sentinel end() { return Sentinel(std::ranges::end(m_First), std::ranges::end(m_Second)); }
+
+	private:
+
+		FirstRange m_First;
+		SecondRange m_Second;
+	};
+
+	template<typename FirstRange, typename SecondRange>
+	inline auto zip(FirstRange&& First, SecondRange&& Second)
+	{
+		using FirstView = std::views::all_t<FirstRange>;
+		using SecondView = std::views::all_t<SecondRange>;
+
+		return ZipView<FirstView, SecondView>(std::views::all(std::forward<FirstRange>(First)), std::views::all(std::forward<SecondRange>(Second)));
+	}
+
+
+	// Builds a ListType from Range, in a single pass over it, keeping its order: the first element of Range becomes the front of the list.
+	template<typename ListType, std::ranges::input_range Range>
+	inline ListType to(Range&& Elements)
+	{
+		// The range constructors of the lists take two iterators of the same type.
+		auto CommonElements = std::views::common(std::forward<Range>(Elements));
+		return ListType(std::ranges::begin(CommonElements), std::ranges::end(CommonElements));
+	}
+}
@@ -0,0 +1,106 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include "SIterator.h"
+#include <cstddef>
+#include <iterator>
+
+
+/**
+ * Forward iterator used in conjunction with ShardedSList.
+ *
+ * It walks the SList of a shard with a ConstSIterator, then jumps to the first element of the next non empty shard.
+ * end() iterators point past the last shard, with an end() ConstSIterator.
+ *
+ * It is a constant iterator, and as such it does not modify its values.
+ *
+ * ShardType can be any type exposing an SList member called List.
+ *
+ * @see ShardedSList, ConstSIterator
+ */
+template<typename T, typename ShardType>
+class ConstShardedSIterator
+{
+public:
+
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = T*;
+	using reference         = T&;
+
+
+	ConstShardedSIterator() = default;
+
+	// Starts from the first element of Shard, or of the first non empty shard after it.
+	inline ConstShardedSIterator(const ShardType* Shard, const ShardType* LastShard)
+		: m_Shard(Shard), m_LastShard(LastShard)
+	{
+		SkipEmptyShards();
+	}
+
+	inline ConstShardedSIterator(const ConstShardedSIterator<T, ShardType>& That)
+		: m_Shard(That.m_Shard), m_LastShard(That.m_LastShard), m_Element(That.m_Element) { }
+
+	~ConstShardedSIterator() = default;
+
+
+	inline ConstShardedSIterator<T, ShardType>& operator= (const ConstShardedSIterator<T, ShardType>& That)
+	{
+		m_Shard = That.m_Shard;
+		m_LastShard = That.m_LastShard;
+		m_Element = That.m_Element;
+		return *this;
+	}
+
+	inline bool operator== (const ConstShardedSIterator<T, ShardType>& That) const
+	{
+		return (m_Shard == That.m_Shard) &&
+			   (m_Element == That.m_Element);
+	}
+
+	inline bool operator!= (const ConstShardedSIterator<T, ShardType>& That) const
+	{
+		return ! operator==(That);
+	}
+
+
+	inline const T& operator* () const { return *m_Element; }
+	inline const T* operator-> () const { return &(*m_Element); }
+
+
+	inline ConstShardedSIterator<T, ShardType>& operator++()
+	{
+		++m_Element;
+
+		if (m_Element == ConstSIterator<T>())
+		{
+			++m_Shard;
+			SkipEmptyShards();
+		}
+
+		return *this;
+	}
+
+	inline ConstShardedSIterator<T, ShardType> operator++(int)
+	{
+		ConstShardedSIterator<T, ShardType> OldIter(*this);
+		operator++();
+		return OldIter;
+	}
+
+
+private:
+
+	inline void SkipEmptyShards()
+	{
+		while (m_Shard != m_LastShard && m_Shard->List.empty()) ++m_Shard;
+
+		m_Element = (m_Shard != m_LastShard) ? m_Shard->List.cbegin() : ConstSIterator<T>();
+	}
+
+	const ShardType* m_Shard = nullptr;
+	const ShardType* m_LastShard = nullptr; // One past the last shard.
+	ConstSIterator<T> m_Element;
+};
@@ -0,0 +1,150 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include "SplitSLink.h"
+#include <cstddef>
+#include <iterator>
+
+
+/**
+ * Forward iterator used in conjunction with SplitSList.
+ *
+ * It uses a pointer to the array of links, a pointer to the array of values and the index of the iterated element.
+ * Incrementing it reads only the links, the values are read only when dereferencing it.
+ * end() iterators have SplitSLink::NullIndex as their index.
+ *
+ * Just like std::vector's iterators, it is invalidated when the list grows.
+ *
+ * Even though it doesn't use the keyword const, this is treated as a constant iterator, and as such it does not modify its values.
+ *
+ * @see SplitSList, SplitSLink
+ */
+template<typename T, typename LinkType>
+class ConstSplitSIterator
+{
+protected:
+
+	using Index = typename LinkType::index_type;
+	using LinkArray = LinkType*;
+	using DataArray = T*;
+
+public:
+
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = T*;
+	using reference         = T&;
+
+
+	ConstSplitSIterator() = default;
+
+	inline ConstSplitSIterator(LinkArray Links, DataArray Data, Index Pointed)
+		: m_Links(Links), m_Data(Data), m_Pointed(Pointed) { }
+
+	inline ConstSplitSIterator(const ConstSplitSIterator<T, LinkType>& That)
+		: m_Links(That.m_Links), m_Data(That.m_Data), m_Pointed(That.m_Pointed) { }
+
+	~ConstSplitSIterator() = default;
+
+
+	inline ConstSplitSIterator<T, LinkType>& operator= (const ConstSplitSIterator<T, LinkType>& That)
+	{
+		m_Links = That.m_Links;
+		m_Data = That.m_Data;
+		m_Pointed = That.m_Pointed;
+		return *this;
+	}
+
+	inline bool operator== (const ConstSplitSIterator<T, LinkType>& That) const
+	{
+		return (m_Links == That.m_Links) &&
+			   (m_Pointed == That.m_Pointed);
+	}
+
+	inline bool operator!= (const ConstSplitSIterator<T, LinkType>& That) const
+	{
+		return ! operator==(That);
+	}
+
+
+	inline const T& operator* () const { return m_Data[m_Pointed]; }
+	inline const T* operator-> () const { return &(m_Data[m_Pointed]); }
+
+	// Reads the link of the iterated element, which holds the hot field if the list has one.
+	inline const LinkType& link() const { return m_Links[m_Pointed]; }
+
+
+	inline ConstSplitSIterator<T, LinkType>& operator++()
+	{
+		m_Pointed = m_Links[m_Pointed].Next;
+		return *this;
+	}
+
+	inline ConstSplitSIterator<T, LinkType> operator++(int)
+	{
+		ConstSplitSIterator<T, LinkType> OldIter(*this);
+		operator++();
+		return OldIter;
+	}
+
+
+protected:
+
+	LinkArray m_Links = nullptr;
+	DataArray m_Data = nullptr;
+	Index m_Pointed = LinkType::NullIndex;
+};
+
+
+
+/**
+ * Forward iterator used in conjunction with SplitSList.
+ *
+ * It uses a pointer to the array of links, a pointer to the array of values and the index of the iterated element.
+ * Incrementing it reads only the links, the values are read only when dereferencing it.
+ * end() iterators have SplitSLink::NullIndex as their index.
+ *
+ * It extends ConstSplitSIterator, allowing for its values to be modified.
+ * SplitSLists with a hot field don't use it, since modifying a value would leave its hot field stale.
+ *
+ * @see SplitSList, SplitSLink
+ */
+template<typename T, typename LinkType>
+class SplitSIterator : public ConstSplitSIterator<T, LinkType>
+{
+	using ConstSplitSIterator<T, LinkType>::m_Data;
+	using ConstSplitSIterator<T, LinkType>::m_Pointed;
+	using typename ConstSplitSIterator<T, LinkType>::LinkArray;
+	using typename ConstSplitSIterator<T, LinkType>::DataArray;
+	using typename ConstSplitSIterator<T, LinkType>::Index;
+
+public:
+
+	inline SplitSIterator() : ConstSplitSIterator<T, LinkType>() { }
+	inline SplitSIterator(LinkArray Links, DataArray Data, Index Pointed) : ConstSplitSIterator<T, LinkType>(Links, Data, Pointed) { }
+	inline SplitSIterator(const ConstSplitSIterator<T, LinkType>& That) : ConstSplitSIterator<T, LinkType>(That) { }
+	~SplitSIterator() = default;
+
+
+	// Const, just like the std iterators: constness of the iterator doesn't apply to the iterated values.
+	inline T& operator* () const { return m_Data[m_Pointed]; }
+	inline T* operator-> () const { return &(m_Data[m_Pointed]); }
+
+
+	// Returning the derived type, they let it model std::forward_iterator, so it can be used with std::ranges.
+
+	inline SplitSIterator<T, LinkType>& operator++()
+	{
+		ConstSplitSIterator<T, LinkType>::operator++();
+		return *this;
+	}
+
+	inline SplitSIterator<T, LinkType> operator++(int)
+	{
+		SplitSIterator<T, LinkType> OldIter(*this);
+		ConstSplitSIterator<T, LinkType>::operator++();
+		return OldIter;
+	}
+};
@@ -0,0 +1,164 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+
+/**
+ * Forward iterator used in conjunction with TombstoneSListArray.
+ *
+ * Just like SIteratorArray, it uses a pointer to the array and the index of the iterated element, decrementing the index when incrementing the iterator.
+ * It also uses a pointer to the list's bitmap of tombstones, where the bit of each erased slot is set: advancing skips them,
+ * scanning the bitmap a word at a time and jumping straight to the next live slot with a bit scan.
+ * Slots are mapped to the bits of their word in reverse, the highest slot to the lowest bit, so that the next live slot is always the lowest set bit:
+ * clearing it takes a single subtraction and a single and, instead of waiting for the bit scan.
+ * The live slots below the iterated one, within its word, are kept in the iterator, so most increments don't read the bitmap at all.
+ * For the same reason, erasing an element invalidates every other iterator.
+ *
+ * Even though it doesn't use the keyword const, this is treated as a constant iterator, and as such it does not modify its values.
+ *
+ * @see TombstoneSListArray, SIteratorArray
+ */
+template<typename T>
+class ConstTombstoneSIterator
+{
+protected:
+
+	using Index = long long int; // Not unsigned, because we need -1 as a valid index for an invalid iterator.
+	using DataArray = T*;
+	using Bitmap = const std::uint64_t*;
+
+public:
+
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = T*;
+	using reference         = T&;
+
+
+	ConstTombstoneSIterator() = default;
+
+	inline ConstTombstoneSIterator(DataArray Data, Bitmap Tombstones, Index DataPointed)
+		: m_Data(Data), m_Tombstones(Tombstones), m_DataPointed(DataPointed)
+	{
+		if (DataPointed > 0) m_LiveBelow = ~Tombstones[DataPointed / 64] & SlotsBelow(DataPointed);
+	}
+
+	ConstTombstoneSIterator(const ConstTombstoneSIterator<T>& That) = default;
+	~ConstTombstoneSIterator() = default;
+
+
+	ConstTombstoneSIterator<T>& operator= (const ConstTombstoneSIterator<T>& That) = default;
+
+	inline bool operator== (const ConstTombstoneSIterator<T>& That) const
+	{
+		return (m_Data == That.m_Data) &&
+			   (m_DataPointed == That.m_DataPointed);
+	}
+
+	inline bool operator!= (const ConstTombstoneSIterator<T>& That) const
+	{
+		return ! operator==(That);
+	}
+
+
+	inline const T& operator* () const { return m_Data[m_DataPointed]; }
+	inline const T* operator-> () const { return &(m_Data[m_DataPointed]); }
+
+
+	inline ConstTombstoneSIterator<T>& operator++()
+	{
+		Index Word = m_DataPointed / 64;
+
+		// Only the words below are read, and only when the current one has no live slots left.
+		while (m_LiveBelow == 0)
+		{
+			if (--Word < 0)
+			{
+				m_DataPointed = -1;
+				return *this;
+			}
+
+			m_LiveBelow = ~m_Tombstones[Word];
+		}
+
+		m_DataPointed = Word * 64 + 63 - std::countr_zero(m_LiveBelow);
+		m_LiveBelow &= m_LiveBelow - 1;
+		return *this;
+	}
+
+	inline ConstTombstoneSIterator<T> operator++(int)
+	{
+		ConstTombstoneSIterator<T> OldIter(*this);
+		operator++();
+		return OldIter;
+	}
+
+
+	// Exposes the iterated index, so that the list can implement operations taking a position, like erase().
+	inline Index index() const { return m_DataPointed; }
+
+	// The bit of Slot in its word of the bitmap, and the bits of the slots below it in the same word.
+	static inline std::uint64_t SlotBit(Index Slot) { return std::uint64_t(1) << (63 - Slot % 64); }
+	static inline std::uint64_t SlotsBelow(Index Slot) { return Slot % 64 == 0 ? 0 : ~std::uint64_t(0) << (64 - Slot % 64); }
+
+
+protected:
+
+	DataArray m_Data = nullptr;
+	Bitmap m_Tombstones = nullptr;
+	Index m_DataPointed = 0;
+	std::uint64_t m_LiveBelow = 0;
+};
+
+
+
+/**
+ * Forward iterator used in conjunction with TombstoneSListArray.
+ *
+ * It extends ConstTombstoneSIterator, allowing for its values to be modified.
+ *
+ * @see TombstoneSListArray, ConstTombstoneSIterator
+ */
+template<typename T>
+class TombstoneSIterator : public ConstTombstoneSIterator<T>
+{
+	using ConstTombstoneSIterator<T>::m_Data;
+	using ConstTombstoneSIterator<T>::m_DataPointed;
+	using typename ConstTombstoneSIterator<T>::DataArray;
+	using typename ConstTombstoneSIterator<T>::Bitmap;
+	using typename ConstTombstoneSIterator<T>::Index;
+
+public:
+
+	TombstoneSIterator() : ConstTombstoneSIterator<T>() { }
+	inline TombstoneSIterator(DataArray Data, Bitmap Tombstones, Index DataPointed) : ConstTombstoneSIterator<T>(Data, Tombstones, DataPointed) { }
+	inline TombstoneSIterator(const ConstTombstoneSIterator<T>& That) : ConstTombstoneSIterator<T>(That) { }
+	~TombstoneSIterator() = default;
+
+
+	// Const, just like the std iterators: constness of the iterator doesn't apply to the iterated values.
+	inline T& operator* () const { return m_Data[m_DataPointed]; }
+	inline T* operator-> () const { return &(m_Data[m_DataPointed]); }
+
+
+	// Returning the derived type, they let it model std::forward_iterator, so it can be used with std::ranges.
+
+	inline TombstoneSIterator<T>& operator++()
+	{
+		ConstTombstoneSIterator<T>::operator++();
+		return *this;
+	}
+
+	inline TombstoneSIterator<T> operator++(int)
+	{
+		TombstoneSIterator<T> OldIter(*this);
+		ConstTombstoneSIterator<T>::operator++();
+		return OldIter;
+	}
+};
@@ -0,0 +1,333 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "SNode.h"
+#include "SIterator.h"
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * Just like SList, it uses SNodes linked together and the SIterator forward iterator,
+ * but the nodes are not allocated one by one: each list owns a chain of node blocks, which grow geometrically.
+ * Popped nodes are recycled by the following pushes, through a free list threaded in their Next pointers.
+ *
+ * A copy allocates a single block, filling it in list order, so that the copied chain is contiguous in memory.
+ * clear() and the destructor release whole blocks at once: for trivially destructible types no node is visited at all.
+ * The downside is that memory is given back only on clear() or destruction, never on pop_front().
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SList, SNode, SIterator
+ */
+template<typename T>
+class ArenaSList final
+{
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = T&;
+	using const_reference  = const T&;
+	using pointer          = T*;
+	using const_pointer    = const T*;
+	using iterator         = SIterator<value_type>;
+	using const_iterator   = ConstSIterator<value_type>;
+
+
+	ArenaSList() = default;
+	ArenaSList(size_type NumberOfElements);
+	ArenaSList(size_type NumberOfElements, const value_type& BaseValue);
+	ArenaSList(std::initializer_list<value_type> IL);
+	ArenaSList(const ArenaSList<value_type>& That);
+	ArenaSList(ArenaSList<value_type>&& That) noexcept;
+	~ArenaSList();
+
+
+	ArenaSList<value_type>& operator= (ArenaSList<value_type> That); // copy-and-swap idiom.
+	ArenaSList<value_type>& operator= (std::initializer_list<value_type> IL);
+
+
+	inline iterator begin() noexcept { return iterator(m_FirstNode); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(m_FirstNode); }
+
+	inline iterator end() noexcept { return iterator(); }
+	inline const_iterator cend() const noexcept { return const_iterator(); }
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	void push_front(const value_type& Value);
+	void pop_front();
+	void clear();
+	void swap(ArenaSList<value_type>& That) noexcept;
+
+	inline reference front() { return m_FirstNode->Data; }
+	inline const_reference front() const { return m_FirstNode->Data; }
+
+	inline bool empty() const { return m_FirstNode == nullptr; }
+	inline size_type size() const noexcept { return m_NumberOfElements; }
+	// Just like std::forward_list, the limit is given by the addressable memory, rather than by the list itself.
+	inline size_type max_size() const noexcept { return static_cast<size_type>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(SNode<value_type>); }
+
+private:
+
+	using node_allocator = std::allocator<SNode<value_type>>;
+
+	struct NodeBlock
+	{
+		NodeBlock* Previous;
+		SNode<value_type>* Nodes;
+		size_type Capacity;
+		size_type Used;
+	};
+
+	static constexpr size_type MinBlockCapacity = 32;
+	static constexpr size_type MaxBlockCapacity = 64 * 1024;
+
+	SNode<value_type>* AllocateNode();
+	void AddBlock(size_type Capacity);
+	void ReleaseBlocks();
+
+	SNode<value_type>* m_FirstNode = nullptr;
+	SNode<value_type>* m_FreeNodes = nullptr; // Popped nodes, linked through Next. Their Data is already destroyed.
+	NodeBlock* m_LastBlock = nullptr;
+	size_type m_NumberOfElements = 0; // Also used to size the single block of a copy.
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+ArenaSList<T>::ArenaSList(size_type NumberOfElements) : ArenaSList<value_type>(NumberOfElements, value_type()) { }
+
+template<typename T>
+ArenaSList<T>::ArenaSList(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+
+template<typename T>
+ArenaSList<T>::ArenaSList(std::initializer_list<value_type> IL) { assign(IL); }
+
+template<typename T>
+ArenaSList<T>::ArenaSList(const ArenaSList<value_type>& That)
+{
+	if (That.empty()) return;
+
+	AddBlock(That.m_NumberOfElements);
+
+	SNode<value_type>* That_CurrentNode = That.m_FirstNode;
+	SNode<value_type>* const Nodes = m_LastBlock->Nodes;
+
+	// Node i links to node i + 1 of the same block, so the copied chain is traversed sequentially in memory.
+	// If copying a value throws, the destructor won't run: the values already copied are destroyed here, and the block released.
+	try
+	{
+		for (size_type i = 0; i < That.m_NumberOfElements; ++i)
+		{
+			SNode<value_type>* Next = (i + 1 < That.m_NumberOfElements) ? Nodes + i + 1 : nullptr;
+			::new (static_cast<void*>(Nodes + i)) SNode<value_type>(Next, That_CurrentNode->Data);
+
+			++m_LastBlock->Used;
+			++m_NumberOfElements;
+			That_CurrentNode = That_CurrentNode->NextNode();
+		}
+	}
+	catch (...)
+	{
+		std::destroy_n(Nodes, m_NumberOfElements);
+		ReleaseBlocks();
+		throw;
+	}
+
+	m_FirstNode = Nodes;
+}
+
+template<typename T>
+ArenaSList<T>::ArenaSList(ArenaSList<value_type>&& That) noexcept
+	: m_FirstNode(That.m_FirstNode), m_FreeNodes(That.m_FreeNodes), m_LastBlock(That.m_LastBlock), m_NumberOfElements(That.m_NumberOfElements)
+{
+	That.m_FirstNode = nullptr;
+	That.m_FreeNodes = nullptr;
+	That.m_LastBlock = nullptr;
+	That.m_NumberOfElements = 0;
+}
+
+template<typename T>
+ArenaSList<T>::~ArenaSList() { clear(); }
+
+
+
+template<typename T>
+auto ArenaSList<T>::operator= (ArenaSList<value_type> That) -> ArenaSList<value_type>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T>
+auto ArenaSList<T>::operator= (std::initializer_list<value_type> IL) -> ArenaSList<value_type>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T>
+void ArenaSList<T>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	clear();
+
+	if (NumberOfElements > 0) AddBlock(NumberOfElements);
+
+	while (NumberOfElements > 0)
+	{
+		push_front(BaseValue);
+		--NumberOfElements;
+	}
+}
+
+template<typename T>
+void ArenaSList<T>::assign(std::initializer_list<value_type> IL)
+{
+	clear();
+
+	if (IL.size() > 0) AddBlock(IL.size());
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+template<typename T>
+void ArenaSList<T>::push_front(const value_type& Value)
+{
+	SNode<value_type>* NewNode = AllocateNode();
+	::new (static_cast<void*>(NewNode)) SNode<value_type>(m_FirstNode, Value);
+
+	m_FirstNode = NewNode;
+	++m_NumberOfElements;
+}
+
+template<typename T>
+void ArenaSList<T>::pop_front()
+{
+	if (m_FirstNode != nullptr)
+	{
+		SNode<value_type>* SecondNode = m_FirstNode->NextNode();
+
+		std::destroy_at(&m_FirstNode->Data);
+		m_FirstNode->Next = m_FreeNodes;
+		m_FreeNodes = m_FirstNode;
+
+		m_FirstNode = SecondNode;
+		--m_NumberOfElements;
+	}
+}
+
+template<typename T>
+void ArenaSList<T>::clear()
+{
+	// Only the nodes still in the list have a live Data: the free ones were destroyed when popped.
+	if constexpr (!std::is_trivially_destructible_v<value_type>)
+	{
+		for (SNode<value_type>* CurrentNode = m_FirstNode; CurrentNode != nullptr; )
+		{
+			SNode<value_type>* NextNode = CurrentNode->NextNode();
+			std::destroy_at(&CurrentNode->Data);
+			CurrentNode = NextNode;
+		}
+	}
+
+	ReleaseBlocks();
+
+	m_FirstNode = nullptr;
+	m_FreeNodes = nullptr;
+	m_NumberOfElements = 0;
+}
+
+template<typename T>
+void ArenaSList<T>::swap(ArenaSList<value_type>& That) noexcept
+{
+	std::swap(m_FirstNode, That.m_FirstNode);
+	std::swap(m_FreeNodes, That.m_FreeNodes);
+	std::swap(m_LastBlock, That.m_LastBlock);
+	std::swap(m_NumberOfElements, That.m_NumberOfElements);
+}
+
+
+
+// Returns uninitialized memory for a node: a recycled one if available, otherwise the next slot of the last block.
+template<typename T>
+SNode<T>* ArenaSList<T>::AllocateNode()
+{
+	if (m_FreeNodes != nullptr)
+	{
+		SNode<value_type>* Node = m_FreeNodes;
+		m_FreeNodes = Node->NextNode();
+		return Node;
+	}
+
+	if (m_LastBlock == nullptr || m_LastBlock->Used == m_LastBlock->Capacity)
+	{
+		const size_type Capacity = (m_LastBlock == nullptr) ? MinBlockCapacity : std::min(m_LastBlock->Capacity * 2, MaxBlockCapacity);
+		AddBlock(Capacity);
+	}
+
+	return m_LastBlock->Nodes + m_LastBlock->Used++;
+}
+
+template<typename T>
+void ArenaSList<T>::AddBlock(size_type Capacity)
+{
+	NodeBlock* NewBlock = new NodeBlock{ m_LastBlock, nullptr, Capacity, 0 };
+
+	try
+	{
+		NewBlock->Nodes = node_allocator().allocate(Capacity);
+	}
+	catch (...)
+	{
+		delete NewBlock;
+		throw;
+	}
+
+	m_LastBlock = NewBlock;
+}
+
+template<typename T>
+void ArenaSList<T>::ReleaseBlocks()
+{
+	while (m_LastBlock != nullptr)
+	{
+		NodeBlock* PreviousBlock = m_LastBlock->Previous;
+
+		node_allocator().deallocate(m_LastBlock->Nodes, m_LastBlock->Capacity);
+		delete m_LastBlock;
+
+		m_LastBlock = PreviousBlock;
+	}
+}
+
+
+
+
+namespace std
+{
+	template<typename T>
+	void swap(ArenaSList<T>& A, ArenaSList<T>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,234 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include "SIteratorArray.h"
+
+
+/**
+ * Capacity of a BoundedSList, as passed to its constructors.
+ * It's a type of its own, explicitly constructed, so that a capacity can't be mistaken for a number of elements.
+ *
+ * @see BoundedSList
+ */
+struct BoundedCapacity final
+{
+	explicit constexpr BoundedCapacity(std::size_t Value) noexcept : Value(Value) { }
+
+	std::size_t Value;
+};
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * Just like FixedSList, it stores its elements in a C-style array, where the element with the highest index is the first on the list,
+ * and its push_front() discards the values exceeding the capacity.
+ * The array is allocated on the free store once, when the list is constructed, with a capacity chosen at runtime, and it's never reallocated:
+ * lists of any capacity share the same type, and therefore the same code, and big capacities don't risk to overflow the stack.
+ *
+ * Uses a custom forward iterator class, called SIteratorArray, which makes use of the underlaying container's linearity.
+ *
+ * The array is default initialized, so T must be default constructible, just like for FixedSList.
+ *
+ * The constructors take the same argument lists of FixedSList's, with the same meaning, building a list of DefaultCapacity.
+ * A different capacity is passed first, wrapped in a BoundedCapacity: BoundedSList<int>(BoundedCapacity{ 3 }, 4) holds up to 3 elements,
+ * while BoundedSList<int>(3, 4) holds three 4s, just like FixedSList<int>(3, 4).
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see FixedSList, SIteratorArray, BoundedCapacity
+ */
+template<typename T>
+class BoundedSList final
+{
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = T&;
+	using const_reference  = const T&;
+	using pointer          = T*;
+	using const_pointer    = const T*;
+	using iterator         = SIteratorArray<value_type>;
+	using const_iterator   = ConstSIteratorArray<value_type>;
+
+	// Capacity of the lists constructed without specifying it, the same default of FixedSList.
+	static constexpr size_type DefaultCapacity = 1000;
+
+
+	BoundedSList() : BoundedSList<value_type>(BoundedCapacity(DefaultCapacity)) { }
+	explicit BoundedSList(size_type NumberOfElements) : BoundedSList<value_type>(BoundedCapacity(DefaultCapacity), NumberOfElements) { }
+	BoundedSList(size_type NumberOfElements, const value_type& BaseValue) : BoundedSList<value_type>(BoundedCapacity(DefaultCapacity), NumberOfElements, BaseValue) { }
+	BoundedSList(std::initializer_list<value_type> IL) : BoundedSList<value_type>(BoundedCapacity(DefaultCapacity), IL) { }
+	explicit BoundedSList(BoundedCapacity Capacity);
+	BoundedSList(BoundedCapacity Capacity, size_type NumberOfElements);
+	BoundedSList(BoundedCapacity Capacity, size_type NumberOfElements, const value_type& BaseValue);
+	BoundedSList(BoundedCapacity Capacity, std::initializer_list<value_type> IL);
+	BoundedSList(const BoundedSList<value_type>& That); // The copy has the same capacity.
+	BoundedSList(BoundedSList<value_type>&& That) noexcept;
+	~BoundedSList() = default;
+
+
+	BoundedSList<value_type>& operator= (BoundedSList<value_type> That) noexcept; // copy-and-swap idiom.
+	BoundedSList<value_type>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+	// For more information, see ConstSIteratorArray.
+
+	inline iterator begin() noexcept { return iterator(m_Data.get(), m_LastElementIndex); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<value_type*>(m_Data.get()), m_LastElementIndex); }
+
+	inline iterator end() noexcept { return iterator(m_Data.get(), -1); }
+	inline const_iterator cend() const noexcept { return const_iterator(const_cast<value_type*>(m_Data.get()), -1); }
+
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	void push_front(const value_type& Value);
+	void pop_front();
+	void clear();
+	void swap(BoundedSList<value_type>& That) noexcept; // O(1), exchanging the arrays and their capacities.
+
+	inline reference front() { return m_Data[m_LastElementIndex]; }
+	inline const_reference front() const { return m_Data[m_LastElementIndex]; }
+
+	inline bool empty() const { return m_LastElementIndex < 0; }
+	inline size_type size() const noexcept { return static_cast<size_type>(m_LastElementIndex + 1); }
+	inline size_type max_size() const noexcept { return m_Capacity; }
+	inline size_type capacity() const noexcept { return m_Capacity; }
+
+private:
+
+	using index_type = long long int;
+
+	std::unique_ptr<value_type[]> m_Data;
+	size_type m_Capacity = 0;
+	index_type m_LastElementIndex = -1;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+BoundedSList<T>::BoundedSList(BoundedCapacity Capacity) : m_Data(new value_type[Capacity.Value]), m_Capacity(Capacity.Value) { }
+
+template<typename T>
+BoundedSList<T>::BoundedSList(BoundedCapacity Capacity, size_type NumberOfElements)
+	: BoundedSList<value_type>(Capacity, NumberOfElements, value_type()) { }
+
+template<typename T>
+BoundedSList<T>::BoundedSList(BoundedCapacity Capacity, size_type NumberOfElements, const value_type& BaseValue)
+	: BoundedSList<value_type>(Capacity) { assign(NumberOfElements, BaseValue); }
+
+template<typename T>
+BoundedSList<T>::BoundedSList(BoundedCapacity Capacity, std::initializer_list<value_type> IL)
+	: BoundedSList<value_type>(Capacity) { assign(IL); }
+
+// The elements are stored in list order, so they're copied with a single call, a memmove for trivially copyable types.
+template<typename T>
+BoundedSList<T>::BoundedSList(const BoundedSList<value_type>& That) : BoundedSList<value_type>(BoundedCapacity(That.m_Capacity))
+{
+	std::copy(That.m_Data.get(), That.m_Data.get() + (That.m_LastElementIndex + 1), m_Data.get());
+	m_LastElementIndex = That.m_LastElementIndex;
+}
+
+template<typename T>
+BoundedSList<T>::BoundedSList(BoundedSList<value_type>&& That) noexcept
+	: m_Data(std::move(That.m_Data)), m_Capacity(That.m_Capacity), m_LastElementIndex(That.m_LastElementIndex)
+{
+	That.m_Capacity = 0;
+	That.m_LastElementIndex = -1;
+}
+
+
+
+template<typename T>
+auto BoundedSList<T>::operator= (BoundedSList<value_type> That) noexcept -> BoundedSList<value_type>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T>
+auto BoundedSList<T>::operator= (std::initializer_list<value_type> IL) -> BoundedSList<value_type>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T>
+void BoundedSList<T>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	// Just like push_front, the values exceeding the capacity are discarded.
+	if (NumberOfElements > m_Capacity) NumberOfElements = m_Capacity;
+
+	// Bulk fill, vectorized by the standard library for trivially copyable types.
+	std::fill_n(m_Data.get(), NumberOfElements, BaseValue);
+	m_LastElementIndex = static_cast<index_type>(NumberOfElements) - 1;
+}
+
+template<typename T>
+void BoundedSList<T>::assign(std::initializer_list<value_type> IL)
+{
+	clear();
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+template<typename T>
+void BoundedSList<T>::push_front(const value_type& Value)
+{
+	if (m_LastElementIndex == static_cast<index_type>(m_Capacity) - 1) return;
+
+	m_Data[++m_LastElementIndex] = Value;
+}
+
+template<typename T>
+void BoundedSList<T>::pop_front()
+{
+	--m_LastElementIndex;
+	if (m_LastElementIndex < 0) m_LastElementIndex = -1;
+}
+
+template<typename T>
+void BoundedSList<T>::clear()
+{
+	m_LastElementIndex = -1;
+}
+
+template<typename T>
+void BoundedSList<T>::swap(BoundedSList<value_type>& That) noexcept
+{
+	std::swap(m_Data, That.m_Data);
+	std::swap(m_Capacity, That.m_Capacity);
+	std::swap(m_LastElementIndex, That.m_LastElementIndex);
+}
+
+
+
+
+namespace std
+{
+	template<typename T>
+	void swap(BoundedSList<T>& A, BoundedSList<T>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,275 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ColumnarSIterator.h"
+#include "FlagVector.h"
+
+
+/**
+ * Forward List of records, compatible with stl and its algorithms.
+ *
+ * A variant of SListArray storing each field of its elements in a std vector of its own, a column, instead of storing the elements as a whole:
+ * scanning a single field only pulls that column through the cache, instead of every field of every element.
+ * Just like SListArray, the element with the highest index is the first on the list, in every column.
+ *
+ * column() exposes each column as a std::span, in storage order, so that vectorized or parallel kernels can scan a single field on their own.
+ * Its last value is the field of the front: std::views::reverse walks it in list order.
+ *
+ * Uses a custom forward iterator class, called ColumnarSIterator, returning a tuple of references to the fields of the iterated element, ColumnarSRecord.
+ *
+ * bool fields are stored in a FlagVector instead, a byte each: std::vector<bool> packs them into bits, so it has no data() to walk or view.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SListArray, ColumnarSIterator, FlagVector
+ */
+template<typename... Fields>
+class ColumnarSListArray final
+{
+	static_assert(sizeof...(Fields) > 0, "ColumnarSListArray needs at least one field.");
+
+public:
+
+	using value_type       = std::tuple<Fields...>;
+	using size_type        = std::size_t;
+	using reference        = ColumnarSRecord<Fields&...>;
+	using const_reference  = ColumnarSRecord<const Fields&...>;
+	using iterator         = ColumnarSIterator<Fields...>;
+	using const_iterator   = ConstColumnarSIterator<Fields...>;
+
+	template<std::size_t Field>
+	using field_type       = std::tuple_element_t<Field, value_type>;
+
+
+	ColumnarSListArray() = default;
+	ColumnarSListArray(size_type NumberOfElements);
+	ColumnarSListArray(size_type NumberOfElements, const value_type& BaseValue);
+	ColumnarSListArray(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> ColumnarSListArray(InputIt First, InputIt Last);
+	ColumnarSListArray(const ColumnarSListArray<Fields...>& That) = default;
+	ColumnarSListArray(ColumnarSListArray<Fields...>&& That) noexcept;
+	~ColumnarSListArray() = default;
+
+
+	ColumnarSListArray<Fields...>& operator= (ColumnarSListArray<Fields...> That) noexcept; // copy-and-swap idiom.
+	ColumnarSListArray<Fields...>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+
+	inline iterator begin() noexcept { return iterator(ColumnsData(), LastIndex()); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<ColumnarSListArray<Fields...>*>(this)->ColumnsData(), LastIndex()); }
+
+	inline iterator end() noexcept { return iterator(ColumnsData(), -1); }
+	inline const_iterator cend() const noexcept { return const_iterator(const_cast<ColumnarSListArray<Fields...>*>(this)->ColumnsData(), -1); }
+
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> void assign(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
+	void push_front(const value_type& Value);
+	void push_front(const Fields&... Values);
+	void pop_front();
+	void reserve(size_type NumberOfElements);
+	void clear();
+	void swap(ColumnarSListArray<Fields...>& That) noexcept;
+
+	inline reference front() { return *begin(); }
+	inline const_reference front() const { return *cbegin(); }
+
+	// The values of a single field, in storage order: the last one belongs to the front of the list.
+	template<std::size_t Field> inline std::span<field_type<Field>> column() noexcept { return std::get<Field>(m_Columns); }
+	template<std::size_t Field> inline std::span<const field_type<Field>> column() const noexcept { return std::get<Field>(m_Columns); }
+
+	inline bool empty() const { return size() == 0; }
+	inline size_type size() const noexcept { return std::get<0>(m_Columns).size(); }
+	inline size_type max_size() const noexcept { return std::get<0>(m_Columns).max_size(); }
+
+private:
+
+	using index_type = long long int;
+
+	template<typename Field>
+	using column_type = std::conditional_t<std::is_same_v<Field, bool>, FlagVector, std::vector<Field>>;
+
+	inline index_type LastIndex() const noexcept { return static_cast<index_type>(size()) - 1; }
+	inline std::tuple<Fields*...> ColumnsData() noexcept { return std::apply([](auto&... Column) { return std::tuple<Fields*...>(Column.data()...); }, m_Columns); }
+
+	// Calls Function on each column, along with the matching field of Value, when given one.
+	template<typename Func> void ForEachColumn(Func&& Function);
+	template<typename Func> void ForEachColumn(const value_type& Value, Func&& Function);
+
+	std::tuple<column_type<Fields>...> m_Columns;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename... Fields>
+ColumnarSListArray<Fields...>::ColumnarSListArray(size_type NumberOfElements) : ColumnarSListArray<Fields...>(NumberOfElements, value_type()) { }
+
+template<typename... Fields>
+ColumnarSListArray<Fields...>::ColumnarSListArray(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+
+template<typename... Fields>
+ColumnarSListArray<Fields...>::ColumnarSListArray(std::initializer_list<value_type> IL) { assign(IL); }
+
+template<typename... Fields>
+template<std::input_iterator InputIt>
+ColumnarSListArray<Fields...>::ColumnarSListArray(InputIt First, InputIt Last) { assign(First, Last); }
+
+template<typename... Fields>
+ColumnarSListArray<Fields...>::ColumnarSListArray(ColumnarSListArray<Fields...>&& That) noexcept : m_Columns(std::move(That.m_Columns))
+{
+	That.clear();
+}
+
+
+
+template<typename... Fields>
+auto ColumnarSListArray<Fields...>::operator= (ColumnarSListArray<Fields...> That) noexcept -> ColumnarSListArray<Fields...>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename... Fields>
+auto ColumnarSListArray<Fields...>::operator= (std::initializer_list<value_type> IL) -> ColumnarSListArray<Fields...>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	ForEachColumn(BaseValue, [NumberOfElements](auto& Column, const auto& Field) { Column.assign(NumberOfElements, Field); });
+}
+
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::assign(std::initializer_list<value_type> IL)
+{
+	// Just like SListArray, the values are stored in the same order they have in IL.
+	clear();
+	reserve(IL.size());
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+template<typename... Fields>
+template<std::input_iterator InputIt>
+void ColumnarSListArray<Fields...>::assign(InputIt First, InputIt Last)
+{
+	clear();
+
+	if constexpr (std::forward_iterator<InputIt>)
+	{
+		reserve(static_cast<size_type>(std::distance(First, Last)));
+	}
+
+	for (; First != Last; ++First)
+	{
+		push_front(*First);
+	}
+
+	ForEachColumn([](auto& Column) { std::reverse(Column.begin(), Column.end()); });
+}
+
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::push_front(const value_type& Value)
+{
+	std::apply([this](const Fields&... Field) { push_front(Field...); }, Value);
+}
+
+// If pushing to a column throws, the columns already pushed to are popped, so that they all keep the same size.
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::push_front(const Fields&... Values)
+{
+	const size_type OldSize = size();
+
+	try
+	{
+		std::apply([&Values...](auto&... Column) { (Column.push_back(Values), ...); }, m_Columns);
+	}
+	catch (...)
+	{
+		ForEachColumn([OldSize](auto& Column) { if (Column.size() > OldSize) Column.pop_back(); });
+		throw;
+	}
+}
+
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::pop_front()
+{
+	ForEachColumn([](auto& Column) { Column.pop_back(); });
+}
+
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::reserve(size_type NumberOfElements)
+{
+	ForEachColumn([NumberOfElements](auto& Column) { Column.reserve(NumberOfElements); });
+}
+
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::clear()
+{
+	ForEachColumn([](auto& Column) { Column.clear(); });
+}
+
+template<typename... Fields>
+void ColumnarSListArray<Fields...>::swap(ColumnarSListArray<Fields...>& That) noexcept
+{
+	std::swap(m_Columns, That.m_Columns);
+}
+
+
+
+template<typename... Fields>
+template<typename Func>
+void ColumnarSListArray<Fields...>::ForEachColumn(Func&& Function)
+{
+	std::apply([&Function](auto&... Column) { (Function(Column), ...); }, m_Columns);
+}
+
+template<typename... Fields>
+template<typename Func>
+void ColumnarSListArray<Fields...>::ForEachColumn(const value_type& Value, Func&& Function)
+{
+	[&]<std::size_t... Field>(std::index_sequence<Field...>)
+	{
+		(Function(std::get<Field>(m_Columns), std::get<Field>(Value)), ...);
+	}
+	(std::index_sequence_for<Fields...>());
+}
+
+
+
+
+namespace std
+{
+	template<typename... Fields>
+	void swap(ColumnarSListArray<Fields...>& A, ColumnarSListArray<Fields...>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
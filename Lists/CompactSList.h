@@ -0,0 +1,261 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "CompactSNode.h"
+#include "CompactSIterator.h"
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * Uses a struct called CompactSNode to store its values and link them together, keeping all of them in a single std vector, the slab.
+ * Nodes link each other through 32 bit indices in the slab instead of pointers: for small types each node takes half the memory of an SNode,
+ * without any per node allocation overhead, so more of them fit in the cache.
+ * Uses a custom forward iterator class, called CompactSIterator, which follows the indices.
+ *
+ * Popped nodes are recycled by the following pushes, through a free list threaded in their Next indices.
+ * A popped value is destroyed right away if its node is the last of the slab, which is always the case when the list is used as a stack;
+ * otherwise it's kept until its node is reused or the list is cleared.
+ *
+ * The slab grows just like a std vector, invalidating iterators, and can't hold more than 2^32 - 1 nodes.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see CompactSNode, CompactSIterator, SList
+ */
+template<typename T>
+class CompactSList final
+{
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = T&;
+	using const_reference  = const T&;
+	using pointer          = T*;
+	using const_pointer    = const T*;
+	using iterator         = CompactSIterator<value_type>;
+	using const_iterator   = ConstCompactSIterator<value_type>;
+
+
+	CompactSList() = default;
+	CompactSList(size_type NumberOfElements);
+	CompactSList(size_type NumberOfElements, const value_type& BaseValue);
+	CompactSList(std::initializer_list<value_type> IL);
+	CompactSList(const CompactSList<value_type>& That);
+	CompactSList(CompactSList<value_type>&& That) noexcept;
+	~CompactSList() = default;
+
+
+	CompactSList<value_type>& operator= (CompactSList<value_type> That) noexcept; // copy-and-swap idiom.
+	CompactSList<value_type>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+
+	inline iterator begin() noexcept { return iterator(m_Nodes.data(), m_FirstNode); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<node_type*>(m_Nodes.data()), m_FirstNode); }
+
+	inline iterator end() noexcept { return iterator(m_Nodes.data(), node_type::NullIndex); }
+	inline const_iterator cend() const noexcept { return const_iterator(const_cast<node_type*>(m_Nodes.data()), node_type::NullIndex); }
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	void push_front(const value_type& Value);
+	void pop_front();
+	void clear() noexcept;
+	void swap(CompactSList<value_type>& That) noexcept;
+
+	inline reference front() { return m_Nodes[m_FirstNode].Data; }
+	inline const_reference front() const { return m_Nodes[m_FirstNode].Data; }
+
+	inline bool empty() const { return m_FirstNode == node_type::NullIndex; }
+	inline size_type size() const noexcept { return m_NumberOfElements; }
+	inline size_type max_size() const noexcept { return node_type::NullIndex; }
+
+private:
+
+	using node_type = CompactSNode<value_type>;
+	using index_type = typename node_type::index_type;
+
+	std::vector<node_type> m_Nodes;
+	index_type m_FirstNode = node_type::NullIndex;
+	index_type m_FreeNodes = node_type::NullIndex; // Popped nodes, linked through Next.
+	index_type m_NumberOfElements = 0; // Also used to reserve the slab of a copy.
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+CompactSList<T>::CompactSList(size_type NumberOfElements) : CompactSList<value_type>(NumberOfElements, value_type()) { }
+
+template<typename T>
+CompactSList<T>::CompactSList(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+
+template<typename T>
+CompactSList<T>::CompactSList(std::initializer_list<value_type> IL) { assign(IL); }
+
+// The copy is compacted: its nodes are stored in list order, without the free ones, so it's traversed sequentially in memory.
+template<typename T>
+CompactSList<T>::CompactSList(const CompactSList<value_type>& That)
+{
+	m_Nodes.reserve(That.m_NumberOfElements);
+
+	for (index_type That_CurrentNode = That.m_FirstNode; That_CurrentNode != node_type::NullIndex; That_CurrentNode = That.m_Nodes[That_CurrentNode].Next)
+	{
+		const index_type NewNode = static_cast<index_type>(m_Nodes.size());
+		const index_type Next = (NewNode + 1 < That.m_NumberOfElements) ? NewNode + 1 : node_type::NullIndex;
+
+		m_Nodes.emplace_back(Next, That.m_Nodes[That_CurrentNode].Data);
+	}
+
+	m_NumberOfElements = That.m_NumberOfElements;
+	m_FirstNode = m_Nodes.empty() ? node_type::NullIndex : 0;
+}
+
+template<typename T>
+CompactSList<T>::CompactSList(CompactSList<value_type>&& That) noexcept
+	: m_Nodes(std::move(That.m_Nodes)), m_FirstNode(That.m_FirstNode), m_FreeNodes(That.m_FreeNodes), m_NumberOfElements(That.m_NumberOfElements)
+{
+	That.m_Nodes.clear();
+	That.m_FirstNode = node_type::NullIndex;
+	That.m_FreeNodes = node_type::NullIndex;
+	That.m_NumberOfElements = 0;
+}
+
+
+
+template<typename T>
+auto CompactSList<T>::operator= (CompactSList<value_type> That) noexcept -> CompactSList<value_type>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T>
+auto CompactSList<T>::operator= (std::initializer_list<value_type> IL) -> CompactSList<value_type>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T>
+void CompactSList<T>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	clear();
+
+	m_Nodes.reserve(NumberOfElements);
+
+	while (NumberOfElements > 0)
+	{
+		push_front(BaseValue);
+		--NumberOfElements;
+	}
+}
+
+template<typename T>
+void CompactSList<T>::assign(std::initializer_list<value_type> IL)
+{
+	clear();
+
+	m_Nodes.reserve(IL.size());
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+template<typename T>
+void CompactSList<T>::push_front(const value_type& Value)
+{
+	if (m_FreeNodes != node_type::NullIndex)
+	{
+		const index_type NewNode = m_FreeNodes;
+		node_type& Node = m_Nodes[NewNode];
+
+		// The value is assigned first: if that throws, the slot is still in the free list.
+		Node.Data = Value;
+
+		m_FreeNodes = Node.Next;
+		Node.Next = m_FirstNode;
+		m_FirstNode = NewNode;
+	}
+	else
+	{
+		if (m_Nodes.size() >= node_type::NullIndex) throw std::length_error("CompactSList can't hold more than 2^32 - 1 nodes.");
+
+		m_Nodes.emplace_back(m_FirstNode, Value);
+		m_FirstNode = static_cast<index_type>(m_Nodes.size() - 1);
+	}
+
+	++m_NumberOfElements;
+}
+
+template<typename T>
+void CompactSList<T>::pop_front()
+{
+	if (m_FirstNode != node_type::NullIndex)
+	{
+		const index_type OldFirstNode = m_FirstNode;
+		m_FirstNode = m_Nodes[OldFirstNode].Next;
+
+		// The popped node is live, so it isn't in the free list: if it's the last node of the slab, it can be removed right away.
+		// Once it's gone, the new last node may be a free one, left in the free list.
+		if (OldFirstNode == m_Nodes.size() - 1)
+		{
+			m_Nodes.pop_back();
+		}
+		else
+		{
+			m_Nodes[OldFirstNode].Next = m_FreeNodes;
+			m_FreeNodes = OldFirstNode;
+		}
+
+		--m_NumberOfElements;
+	}
+}
+
+template<typename T>
+void CompactSList<T>::clear() noexcept
+{
+	m_Nodes.clear();
+	m_FirstNode = node_type::NullIndex;
+	m_FreeNodes = node_type::NullIndex;
+	m_NumberOfElements = 0;
+}
+
+template<typename T>
+void CompactSList<T>::swap(CompactSList<value_type>& That) noexcept
+{
+	std::swap(m_Nodes, That.m_Nodes);
+	std::swap(m_FirstNode, That.m_FirstNode);
+	std::swap(m_FreeNodes, That.m_FreeNodes);
+	std::swap(m_NumberOfElements, That.m_NumberOfElements);
+}
+
+
+
+
+namespace std
+{
+	template<typename T>
+	void swap(CompactSList<T>& A, CompactSList<T>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,27 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstdint>
+
+
+/**
+ * Simple support struct used by CompactSList, to implement a Forward List.
+ * Unlike SNode it doesn't point to the next node, but stores its index in the slab of nodes owned by the list:
+ * on 64 bit builds this halves the size of the link, and the size of the whole node for small types.
+ *
+ * @see CompactSList, SNode
+ */
+template<typename T>
+struct CompactSNode final
+{
+	using index_type = std::uint32_t;
+
+	static constexpr index_type NullIndex = UINT32_MAX;
+
+	index_type Next = NullIndex;
+	T Data;
+
+	CompactSNode() = delete;
+	inline CompactSNode(index_type _Next, const T& _Data) : Next(_Next), Data(_Data) { }
+};
@@ -0,0 +1,268 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+#include "SIteratorArray.h"
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * Just like SListArray, it uses a std vector as its underlying container, where the element with the highest index is the first on the list,
+ * and the SIteratorArray forward iterator.
+ *
+ * The vector is shared between copies, which are therefore O(1), and it is cloned only by the first operation that could modify it:
+ * push_front(), pop_front(), the non const begin() and end(), and the non const front().
+ * This makes it a good fit for lists that are copied often, but rarely modified.
+ *
+ * The non const begin(), end() and front() hand out handles which can modify the buffer later on: once they have, the list stops sharing it,
+ * and its copies clone it right away, just like SListArray's, until assign() or clear() replace it.
+ *
+ * The buffer counts the lists owning it atomically, so copies of the same list can be used and destroyed from different threads.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SListArray, SIteratorArray
+ */
+template<typename T>
+class CowSListArray final
+{
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = T&;
+	using const_reference  = const T&;
+	using pointer          = T*;
+	using const_pointer    = const T*;
+	using iterator         = SIteratorArray<value_type>;
+	using const_iterator   = ConstSIteratorArray<value_type>;
+
+
+	CowSListArray() = default;
+	CowSListArray(size_type NumberOfElements);
+	CowSListArray(size_type NumberOfElements, const value_type& BaseValue);
+	CowSListArray(std::initializer_list<value_type> IL);
+	CowSListArray(const CowSListArray<value_type>& That); // Shares the buffer, unless That handed out mutable handles to it.
+	CowSListArray(CowSListArray<value_type>&& That) noexcept;
+	~CowSListArray();
+
+
+	CowSListArray<value_type>& operator= (CowSListArray<value_type> That) noexcept; // copy-and-swap idiom.
+	CowSListArray<value_type>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+	// For more information, see ConstSIteratorArray.
+	// begin() detaches the buffer, because the returned iterator may be used to modify the elements.
+
+	inline iterator begin() { std::vector<value_type>& Data = MutableHandleData(); return iterator(Data.data(), Data.size() - 1); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<value_type*>(DataPointer()), Size() - 1); }
+
+	inline iterator end() { return iterator(MutableHandleData().data(), -1); }
+	inline const_iterator cend() const noexcept { return const_iterator(const_cast<value_type*>(DataPointer()), -1); }
+
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	void push_front(const value_type& Value);
+	void pop_front();
+	void clear() noexcept;
+	void swap(CowSListArray<value_type>& That) noexcept;
+
+	inline reference front() { return MutableHandleData().back(); }
+	inline const_reference front() const { return m_Buffer->Data.back(); }
+
+	inline bool empty() const noexcept { return Size() == 0; }
+	inline size_type size() const noexcept { return static_cast<size_type>(Size()); }
+	inline size_type max_size() const noexcept { return std::vector<value_type>().max_size(); }
+
+private:
+
+	using index_type = long long int;
+
+	struct SharedBuffer
+	{
+		std::vector<value_type> Data;
+		std::atomic<std::size_t> Owners = 1;
+	};
+
+	inline const value_type* DataPointer() const noexcept { return m_Buffer ? m_Buffer->Data.data() : nullptr; }
+	inline index_type Size() const noexcept { return m_Buffer ? static_cast<index_type>(m_Buffer->Data.size()) : 0; }
+
+	std::vector<value_type>& MutableData();
+	std::vector<value_type>& MutableHandleData();
+	void ReplaceBuffer(SharedBuffer* NewBuffer) noexcept;
+
+	static void RemoveOwner(SharedBuffer* Buffer) noexcept;
+
+	// Null until the first element is added. Shared between copies until one of them gets modified.
+	SharedBuffer* m_Buffer = nullptr;
+	// Set once a mutable handle to the buffer has been handed out: until the buffer is replaced, copies clone it instead of sharing it.
+	bool m_Unshareable = false;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+CowSListArray<T>::CowSListArray(size_type NumberOfElements) : CowSListArray<value_type>(NumberOfElements, value_type()) { }
+
+template<typename T>
+CowSListArray<T>::CowSListArray(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+
+template<typename T>
+CowSListArray<T>::CowSListArray(std::initializer_list<value_type> IL) { assign(IL); }
+
+template<typename T>
+CowSListArray<T>::CowSListArray(const CowSListArray<value_type>& That)
+{
+	if (That.m_Buffer == nullptr) return;
+
+	if (That.m_Unshareable)
+	{
+		m_Buffer = new SharedBuffer{ That.m_Buffer->Data };
+	}
+	else
+	{
+		That.m_Buffer->Owners.fetch_add(1, std::memory_order_relaxed);
+		m_Buffer = That.m_Buffer;
+	}
+}
+
+template<typename T>
+CowSListArray<T>::CowSListArray(CowSListArray<value_type>&& That) noexcept
+	: m_Buffer(std::exchange(That.m_Buffer, nullptr)), m_Unshareable(std::exchange(That.m_Unshareable, false)) { }
+
+template<typename T>
+CowSListArray<T>::~CowSListArray() { RemoveOwner(m_Buffer); }
+
+
+
+template<typename T>
+auto CowSListArray<T>::operator=(CowSListArray<value_type> That) noexcept -> CowSListArray<value_type>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T>
+auto CowSListArray<T>::operator=(std::initializer_list<value_type> IL) -> CowSListArray<value_type>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+// Both assign() overloads replace the whole content, so a shared buffer is not cloned, just replaced.
+
+template<typename T>
+void CowSListArray<T>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	ReplaceBuffer(new SharedBuffer{ std::vector<value_type>(NumberOfElements, BaseValue) });
+}
+
+template<typename T>
+void CowSListArray<T>::assign(std::initializer_list<value_type> IL)
+{
+	// Pushing each value to the front stores them in the same order they have in IL.
+	ReplaceBuffer(new SharedBuffer{ std::vector<value_type>(IL) });
+}
+
+template<typename T>
+void CowSListArray<T>::push_front(const value_type& Value)
+{
+	MutableData().push_back(Value);
+}
+
+template<typename T>
+void CowSListArray<T>::pop_front()
+{
+	MutableData().pop_back();
+}
+
+template<typename T>
+void CowSListArray<T>::clear() noexcept
+{
+	// Other copies may still be using the buffer, so it's released instead of being cleared.
+	ReplaceBuffer(nullptr);
+}
+
+template<typename T>
+void CowSListArray<T>::swap(CowSListArray<value_type>& That) noexcept
+{
+	std::swap(m_Buffer, That.m_Buffer);
+	std::swap(m_Unshareable, That.m_Unshareable);
+}
+
+
+
+// Returns a buffer owned only by this list, cloning the shared one if needed.
+// When there's a single owner no other list can be sharing the buffer, and no other copy can appear while this one is being modified.
+// The acquire load pairs with the acq_rel decrement of RemoveOwner(): whatever the other owners did with the buffer before releasing it
+// happens before this list modifies it.
+template<typename T>
+std::vector<T>& CowSListArray<T>::MutableData()
+{
+	if (m_Buffer == nullptr)
+	{
+		m_Buffer = new SharedBuffer();
+	}
+	else if (m_Buffer->Owners.load(std::memory_order_acquire) > 1)
+	{
+		SharedBuffer* Clone = new SharedBuffer{ m_Buffer->Data };
+		RemoveOwner(m_Buffer);
+		m_Buffer = Clone;
+	}
+
+	return m_Buffer->Data;
+}
+
+// An unshareable buffer is never shared: copying the list clones it, and it was unshared by MutableData() before being marked.
+template<typename T>
+std::vector<T>& CowSListArray<T>::MutableHandleData()
+{
+	std::vector<value_type>& Data = MutableData();
+	m_Unshareable = true;
+	return Data;
+}
+
+template<typename T>
+void CowSListArray<T>::ReplaceBuffer(SharedBuffer* NewBuffer) noexcept
+{
+	RemoveOwner(m_Buffer);
+	m_Buffer = NewBuffer;
+	m_Unshareable = false;
+}
+
+template<typename T>
+void CowSListArray<T>::RemoveOwner(SharedBuffer* Buffer) noexcept
+{
+	if (Buffer != nullptr && Buffer->Owners.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		delete Buffer;
+	}
+}
+
+
+
+
+namespace std
+{
+	template<typename T>
+	void swap(CowSListArray<T>& A, CowSListArray<T>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
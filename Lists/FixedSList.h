@@ -2,8 +2,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
 #include "SIteratorArray.h"
+#include "PackedFixedSList.h"
 
 
 /**
@@ -14,6 +19,8 @@
  *
  * Uses a custom forward iterator class, called SIteratorArray, which makes use of the underlaying container's linearity.
  *
+ * Every operation is constexpr, so a FixedSList can be filled during constant evaluation and stored in a constexpr variable.
+ *
  * Note: just like std containers, it won't delete user allocated's memory!
  *
  * @see SIteratorArray
@@ -33,47 +40,54 @@ public:
 	using const_iterator   = ConstSIteratorArray<value_type>;
 
 
-	FixedSList() = default;
-	FixedSList(size_type NumberOfElements);
-	FixedSList(size_type NumberOfElements, const value_type& BaseValue);
-	FixedSList(std::initializer_list<value_type> IL);
-	FixedSList(const FixedSList<value_type, Capacity>& That);
+	constexpr FixedSList();
+	constexpr FixedSList(size_type NumberOfElements);
+	constexpr FixedSList(size_type NumberOfElements, const value_type& BaseValue);
+	constexpr FixedSList(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> constexpr FixedSList(InputIt First, InputIt Last);
+	constexpr FixedSList(const FixedSList<value_type, Capacity>& That);
 	// There isn't a move constructor, because there aren't dynamic allocations.
-	~FixedSList();
+	// The destructor is defaulted, since clear() only resets an index: this keeps FixedSList a literal type.
+	constexpr ~FixedSList() = default;
 
 
-	FixedSList<value_type, Capacity>& operator= (const FixedSList<value_type, Capacity>& That);
-	FixedSList<value_type, Capacity>& operator= (std::initializer_list<value_type> IL);
+	constexpr FixedSList<value_type, Capacity>& operator= (const FixedSList<value_type, Capacity>& That);
+	constexpr FixedSList<value_type, Capacity>& operator= (std::initializer_list<value_type> IL);
 
 
 	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
 	// This is safe, because the const_iterator does not modify its value.
 	// For more information, see ConstSIteratorArray.
 
-	inline iterator begin() noexcept { return iterator(m_Data, m_LastElementIndex); }
-	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<value_type*>(m_Data), m_LastElementIndex); }
+	constexpr iterator begin() noexcept { return iterator(m_Data, m_LastElementIndex); }
+	constexpr const_iterator cbegin() const noexcept { return const_iterator(const_cast<value_type*>(m_Data), m_LastElementIndex); }
 
-	inline iterator end() noexcept { return iterator(m_Data, -1); }
-	inline const_iterator cend() const noexcept { return const_iterator(const_cast<value_type*>(m_Data), -1); }
+	constexpr iterator end() noexcept { return iterator(m_Data, -1); }
+	constexpr const_iterator cend() const noexcept { return const_iterator(const_cast<value_type*>(m_Data), -1); }
 
 
-	void assign(size_type NumberOfElements, const value_type& BaseValue);
-	void assign(std::initializer_list<value_type> IL);
-	void push_front(const value_type& Value);
-	void pop_front();
-	void clear();
-	void swap(FixedSList<value_type, Capacity>& That) noexcept;
+	constexpr void assign(size_type NumberOfElements, const value_type& BaseValue);
+	constexpr void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> constexpr void assign(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
+	constexpr void push_front(const value_type& Value);
+	constexpr void pop_front();
+	constexpr void clear();
+	constexpr void swap(FixedSList<value_type, Capacity>& That) noexcept;
 
-	inline reference front() { return m_Data[m_LastElementIndex]; }
-	inline const_reference front() const { return m_Data[m_LastElementIndex]; }
+	constexpr reference front() { return m_Data[m_LastElementIndex]; }
+	constexpr const_reference front() const { return m_Data[m_LastElementIndex]; }
 
-	inline bool empty() const { return m_LastElementIndex < 0; }
+	constexpr bool empty() const { return m_LastElementIndex < 0; }
+	constexpr size_type size() const noexcept { return static_cast<size_type>(m_LastElementIndex + 1); }
+	constexpr size_type max_size() const noexcept { return Capacity; }
 
 private:
 
 	using index_type = long long int;
 
-	value_type m_Data[Capacity]; // C26495, ignore this warning, this doesn't need to be initialized.
+	constexpr void CopyElementsFrom(const FixedSList<value_type, Capacity>& That);
+
+	value_type m_Data[Capacity]; // C26495, ignore this warning, this doesn't need to be initialized (except during constant evaluation).
 	index_type m_LastElementIndex = -1;
 };
 
@@ -85,44 +99,49 @@ private:
 
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-FixedSList<T, Capacity>::FixedSList(size_type NumberOfElements)
+constexpr FixedSList<T, Capacity>::FixedSList()
+{
+	// A constant expression cannot hold indeterminate values, so the unused slots are initialized only when constant evaluated.
+	// At runtime the array is left untouched, as it always was.
+	if (std::is_constant_evaluated())
+	{
+		for (value_type& Slot : m_Data) Slot = value_type();
+	}
+}
+
+template<typename T, std::size_t Capacity /*= 1000*/>
+constexpr FixedSList<T, Capacity>::FixedSList(size_type NumberOfElements)
 	: FixedSList<value_type, Capacity>(NumberOfElements, value_type()) { }
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-FixedSList<T, Capacity>::FixedSList(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+constexpr FixedSList<T, Capacity>::FixedSList(size_type NumberOfElements, const value_type& BaseValue)
+	: FixedSList<value_type, Capacity>() { assign(NumberOfElements, BaseValue); }
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-FixedSList<T, Capacity>::FixedSList(std::initializer_list<value_type> IL) { assign(IL); }
+constexpr FixedSList<T, Capacity>::FixedSList(std::initializer_list<value_type> IL)
+	: FixedSList<value_type, Capacity>() { assign(IL); }
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-FixedSList<T, Capacity>::FixedSList(const FixedSList<value_type, Capacity>& That)
+template<std::input_iterator InputIt>
+constexpr FixedSList<T, Capacity>::FixedSList(InputIt First, InputIt Last)
+	: FixedSList<value_type, Capacity>() { assign(First, Last); }
+
+template<typename T, std::size_t Capacity /*= 1000*/>
+constexpr FixedSList<T, Capacity>::FixedSList(const FixedSList<value_type, Capacity>& That)
+	: FixedSList<value_type, Capacity>()
 {
-	while (m_LastElementIndex != That.m_LastElementIndex)
-	{
-		push_front(That.m_Data[m_LastElementIndex + 1]);
-	}
+	CopyElementsFrom(That);
 }
 
-template<typename T, std::size_t Capacity>
-FixedSList<T, Capacity>::~FixedSList() { clear(); }
-
-
-
 template<typename T, std::size_t Capacity /*= 1000*/>
-auto FixedSList<T, Capacity>::operator=(const FixedSList<value_type, Capacity>& That) -> FixedSList<value_type, Capacity>&
+constexpr auto FixedSList<T, Capacity>::operator=(const FixedSList<value_type, Capacity>& That) -> FixedSList<value_type, Capacity>&
 {
-	clear();
-
-	while (m_LastElementIndex != That.m_LastElementIndex)
-	{
-		push_front(That.m_Data[m_LastElementIndex + 1]);
-	}
-
+	if (this != &That) CopyElementsFrom(That);
 	return *this;
 }
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-auto FixedSList<T, Capacity>::operator=(std::initializer_list<value_type> IL) -> FixedSList<value_type, Capacity>&
+constexpr auto FixedSList<T, Capacity>::operator=(std::initializer_list<value_type> IL) -> FixedSList<value_type, Capacity>&
 {
 	assign(IL);
 	return *this;
@@ -132,19 +151,18 @@ auto FixedSList<T, Capacity>::operator=(std::initializer_list<value_type> IL) ->
 
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-void FixedSList<T, Capacity>::assign(size_type NumberOfElements, const value_type& BaseValue)
+constexpr void FixedSList<T, Capacity>::assign(size_type NumberOfElements, const value_type& BaseValue)
 {
-	clear();
+	// Just like push_front, the values exceeding the capacity are discarded.
+	if (NumberOfElements > Capacity) NumberOfElements = Capacity;
 
-	while (NumberOfElements > 0)
-	{
-		push_front(BaseValue);
-		--NumberOfElements;
-	}
+	// Bulk fill, vectorized by the standard library for trivially copyable types.
+	std::fill_n(m_Data, NumberOfElements, BaseValue);
+	m_LastElementIndex = static_cast<index_type>(NumberOfElements) - 1;
 }
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-void FixedSList<T, Capacity>::assign(std::initializer_list<value_type> IL)
+constexpr void FixedSList<T, Capacity>::assign(std::initializer_list<value_type> IL)
 {
 	clear();
 
@@ -154,8 +172,24 @@ void FixedSList<T, Capacity>::assign(std::initializer_list<value_type> IL)
 	}
 }
 
+// Only the first Capacity elements of the range are kept, then they're reversed in place, so that its first element ends up at the highest index.
 template<typename T, std::size_t Capacity /*= 1000*/>
-void FixedSList<T, Capacity>::push_front(const value_type& Value)
+template<std::input_iterator InputIt>
+constexpr void FixedSList<T, Capacity>::assign(InputIt First, InputIt Last)
+{
+	size_type NumberOfElements = 0;
+
+	for (; First != Last && NumberOfElements < Capacity; ++First)
+	{
+		m_Data[NumberOfElements++] = *First;
+	}
+
+	std::reverse(m_Data, m_Data + NumberOfElements);
+	m_LastElementIndex = static_cast<index_type>(NumberOfElements) - 1;
+}
+
+template<typename T, std::size_t Capacity /*= 1000*/>
+constexpr void FixedSList<T, Capacity>::push_front(const value_type& Value)
 {
 	if (m_LastElementIndex == Capacity - 1) return;
 
@@ -163,20 +197,29 @@ void FixedSList<T, Capacity>::push_front(const value_type& Value)
 }
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-void FixedSList<T, Capacity>::pop_front()
+constexpr void FixedSList<T, Capacity>::pop_front()
 {
 	--m_LastElementIndex;
 	if (m_LastElementIndex < 0) m_LastElementIndex = -1;
 }
 
 template<typename T, std::size_t Capacity /*= 1000*/>
-void FixedSList<T, Capacity>::clear()
+constexpr void FixedSList<T, Capacity>::clear()
 {
 	m_LastElementIndex = -1;
 }
 
+// The elements are stored in list order, so they can be copied with a single call instead of a push_front each:
+// std::copy is constexpr, and at runtime it becomes a memmove for trivially copyable types.
 template<typename T, std::size_t Capacity /*= 1000*/>
-void FixedSList<T, Capacity>::swap(FixedSList<value_type, Capacity>& That) noexcept
+constexpr void FixedSList<T, Capacity>::CopyElementsFrom(const FixedSList<value_type, Capacity>& That)
+{
+	std::copy(That.m_Data, That.m_Data + (That.m_LastElementIndex + 1), m_Data);
+	m_LastElementIndex = That.m_LastElementIndex;
+}
+
+template<typename T, std::size_t Capacity /*= 1000*/>
+constexpr void FixedSList<T, Capacity>::swap(FixedSList<value_type, Capacity>& That) noexcept
 {
 	FixedSList<value_type, Capacity> TmpList = That;
 	That = *this;
@@ -189,8 +232,20 @@ void FixedSList<T, Capacity>::swap(FixedSList<value_type, Capacity>& That) noexc
 namespace std
 {
 	template<typename T, std::size_t Capacity /*= 1000*/>
-	void swap(FixedSList<T, Capacity>& A, FixedSList<T, Capacity>& B) noexcept
+	constexpr void swap(FixedSList<T, Capacity>& A, FixedSList<T, Capacity>& B) noexcept
 	{
 		A.swap(B);
 	}
 }
+
+
+
+// Flags are packed by PackedFixedSList, one bit each instead of a byte.
+template<std::size_t Capacity>
+class FixedSList<bool, Capacity> final : public PackedFixedSList<bool, 1, Capacity>
+{
+public:
+
+	using PackedFixedSList<bool, 1, Capacity>::PackedFixedSList;
+	using PackedFixedSList<bool, 1, Capacity>::operator=;
+};
@@ -0,0 +1,137 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+
+
+/**
+ * Simple support class used by ColumnarSListArray, to store its bool columns.
+ *
+ * Growable array of bools, each one in a byte of its own: unlike std::vector<bool>, which packs them into bits, it exposes data(),
+ * so a bool column can be walked through a bool pointer and viewed as a std::span<bool>, just like any other column.
+ * It implements the subset of std::vector used by ColumnarSListArray, growing geometrically just like it.
+ *
+ * @see ColumnarSListArray
+ */
+class FlagVector final
+{
+public:
+
+	using value_type = bool;
+	using size_type  = std::size_t;
+	using iterator   = bool*;
+	using const_iterator = const bool*;
+
+
+	FlagVector() = default;
+	FlagVector(const FlagVector& That);
+	FlagVector(FlagVector&& That) noexcept;
+	~FlagVector() = default;
+
+
+	FlagVector& operator= (FlagVector That) noexcept; // copy-and-swap idiom.
+
+
+	inline bool* data() noexcept { return m_Data.get(); }
+	inline const bool* data() const noexcept { return m_Data.get(); }
+
+	inline iterator begin() noexcept { return m_Data.get(); }
+	inline const_iterator begin() const noexcept { return m_Data.get(); }
+
+	inline iterator end() noexcept { return m_Data.get() + m_Size; }
+	inline const_iterator end() const noexcept { return m_Data.get() + m_Size; }
+
+	void assign(size_type NumberOfElements, bool Value);
+	void push_back(bool Value);
+	inline void pop_back() noexcept { --m_Size; }
+	void reserve(size_type NumberOfElements);
+	inline void clear() noexcept { m_Size = 0; }
+	void swap(FlagVector& That) noexcept;
+
+	inline size_type size() const noexcept { return m_Size; }
+	inline size_type capacity() const noexcept { return m_Capacity; }
+	inline size_type max_size() const noexcept { return static_cast<size_type>(std::numeric_limits<std::ptrdiff_t>::max()); }
+
+private:
+
+	std::unique_ptr<bool[]> m_Data;
+	size_type m_Size = 0;
+	size_type m_Capacity = 0;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+inline FlagVector::FlagVector(const FlagVector& That)
+{
+	reserve(That.m_Size);
+
+	std::copy(That.begin(), That.end(), m_Data.get());
+	m_Size = That.m_Size;
+}
+
+inline FlagVector::FlagVector(FlagVector&& That) noexcept
+	: m_Data(std::move(That.m_Data)), m_Size(std::exchange(That.m_Size, 0)), m_Capacity(std::exchange(That.m_Capacity, 0)) { }
+
+
+
+inline FlagVector& FlagVector::operator= (FlagVector That) noexcept
+{
+	swap(That);
+	return *this;
+}
+
+
+
+
+inline void FlagVector::assign(size_type NumberOfElements, bool Value)
+{
+	reserve(NumberOfElements);
+
+	std::fill_n(m_Data.get(), NumberOfElements, Value);
+	m_Size = NumberOfElements;
+}
+
+inline void FlagVector::push_back(bool Value)
+{
+	if (m_Size == m_Capacity) reserve(std::max<size_type>(2 * m_Capacity, 1));
+
+	m_Data[m_Size++] = Value;
+}
+
+inline void FlagVector::reserve(size_type NumberOfElements)
+{
+	if (NumberOfElements <= m_Capacity) return;
+
+	std::unique_ptr<bool[]> Grown(new bool[NumberOfElements]);
+	std::copy(begin(), end(), Grown.get());
+
+	m_Data = std::move(Grown);
+	m_Capacity = NumberOfElements;
+}
+
+inline void FlagVector::swap(FlagVector& That) noexcept
+{
+	std::swap(m_Data, That.m_Data);
+	std::swap(m_Size, That.m_Size);
+	std::swap(m_Capacity, That.m_Capacity);
+}
+
+
+
+
+namespace std
+{
+	inline void swap(FlagVector& A, FlagVector& B) noexcept
+	{
+		A.swap(B);
+	}
+}
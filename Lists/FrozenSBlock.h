@@ -0,0 +1,63 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+/**
+ * Simple support struct used by FrozenSList, to implement a compressed, read-only Forward List of integers.
+ *
+ * Elements are grouped in blocks of Size: each block stores its first value, and the differences between each of its following values and the previous one.
+ * Differences are zigzag encoded, so that small negative ones become small unsigned codes too, then packed in Width bits each, starting at BitOffset
+ * in the list's array of 64 bit words: Width is the smallest one fitting all the codes of the block.
+ *
+ * @see FrozenSList, ConstFrozenSIterator
+ */
+template<typename T>
+struct FrozenSBlock final
+{
+	static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "Only integers can be frozen.");
+
+	using Word = std::uint64_t;
+	using Unsigned = std::make_unsigned_t<T>;
+
+	static constexpr std::size_t Size = 128;
+
+	T First = T();
+	std::uint64_t BitOffset = 0;
+	unsigned int Width = 0;
+
+
+	// Differences are computed as unsigned, so they wrap around instead of overflowing.
+	static inline Word Encode(T Previous, T Value)
+	{
+		const Unsigned Delta = static_cast<Unsigned>(static_cast<Unsigned>(Value) - static_cast<Unsigned>(Previous));
+		const Unsigned Sign = static_cast<Unsigned>(0 - (Delta >> (std::numeric_limits<Unsigned>::digits - 1)));
+
+		return static_cast<Word>(static_cast<Unsigned>(static_cast<Unsigned>(Delta << 1) ^ Sign));
+	}
+
+	static inline T Decode(T Previous, Word Code)
+	{
+		const Unsigned Zigzag = static_cast<Unsigned>(Code);
+		const Unsigned Delta = static_cast<Unsigned>((Zigzag >> 1) ^ static_cast<Unsigned>(0 - (Zigzag & 1)));
+
+		return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(Previous) + Delta));
+	}
+
+	static inline Word Mask(unsigned int Width) { return Width < 64 ? (Word(1) << Width) - 1 : ~Word(0); }
+
+	// Reads the bits starting at BitPosition, which may straddle two words: the following word is always read, without branching,
+	// shifted in two steps so that the shift is never 64 bits wide. The list pads its words, so the following one always exists.
+	static inline Word Read(const Word* Words, std::uint64_t BitPosition, Word Mask)
+	{
+		const std::size_t WordIndex = static_cast<std::size_t>(BitPosition / 64);
+		const unsigned int Shift = static_cast<unsigned int>(BitPosition % 64);
+
+		return ((Words[WordIndex] >> Shift) | ((Words[WordIndex + 1] << 1) << (63 - Shift))) & Mask;
+	}
+};
@@ -0,0 +1,234 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "FrozenSBlock.h"
+#include "FrozenSIterator.h"
+
+
+/**
+ * Read-only Forward List of integers, compressed, compatible with stl and its algorithms.
+ *
+ * Built once from any other list, through freeze() or its range constructor, then never modified: meant for lists that stay resident for a long time.
+ * Elements are grouped in blocks of FrozenSBlock::Size, each one storing its first value, and the differences between its following values, bit-packed
+ * with the smallest width fitting them all: lists of close or slowly changing values shrink to a few bits per element.
+ *
+ * Uses a custom forward iterator class, called ConstFrozenSIterator, which decodes the elements while advancing, in list order.
+ * for_each() decodes a whole block at a time instead, unpacking all of its differences before adding them up.
+ *
+ * @see FrozenSBlock, ConstFrozenSIterator
+ */
+template<typename T>
+class FrozenSList final
+{
+	using Block = FrozenSBlock<T>;
+	using Word = typename Block::Word;
+
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = T;
+	using const_reference  = T;
+	using iterator         = ConstFrozenSIterator<value_type>;
+	using const_iterator   = ConstFrozenSIterator<value_type>;
+
+
+	FrozenSList() = default;
+	template<std::input_iterator InputIt> FrozenSList(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
+	FrozenSList(const FrozenSList<value_type>& That) = default;
+	// Allocates the empty block of the moved-from list, so unlike the move assignment it may throw.
+	FrozenSList(FrozenSList<value_type>&& That);
+	~FrozenSList() = default;
+
+
+	FrozenSList<value_type>& operator= (const FrozenSList<value_type>& That) = default;
+	// Leaves That empty, with the empty block ending its blocks, just like a default constructed list.
+	FrozenSList<value_type>& operator= (FrozenSList<value_type>&& That) noexcept;
+
+
+	inline const_iterator begin() const noexcept { return cbegin(); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(m_Blocks.data(), m_Words.data(), 0); }
+
+	inline const_iterator end() const noexcept { return cend(); }
+	inline const_iterator cend() const noexcept { return const_iterator(m_Blocks.data(), m_Words.data(), m_Size); }
+
+
+	// Calls Function on each value, in list order.
+	template<typename Func> void for_each(Func&& Function) const;
+
+	inline const_reference front() const { return m_Blocks.front().First; }
+
+	inline bool empty() const { return m_Size == 0; }
+	inline size_type size() const noexcept { return m_Size; }
+	inline size_type max_size() const noexcept { return m_Words.max_size(); }
+
+	// Bytes taken by the encoded elements: the blocks and the packed words.
+	inline size_type memory_usage() const noexcept { return m_Blocks.capacity() * sizeof(Block) + m_Words.capacity() * sizeof(Word); }
+
+private:
+
+	void AppendBlock(const value_type* Values, size_type NumberOfValues);
+	void AppendBits(Word Bits, unsigned int Width);
+
+	// Always ends with an empty block, even when the list is empty, so that the iterators have a block to load.
+	std::vector<Block> m_Blocks = std::vector<Block>(1);
+	std::vector<Word> m_Words;
+	std::uint64_t m_BitCount = 0;
+	size_type m_Size = 0;
+};
+
+
+// Compresses any list of integers, keeping its order.
+template<typename ListType>
+FrozenSList<typename ListType::value_type> freeze(const ListType& List)
+{
+	return FrozenSList<typename ListType::value_type>(List.cbegin(), List.cend());
+}
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+// Values are gathered a block at a time, so the range is read in a single pass, and it doesn't need to be sized.
+template<typename T>
+template<std::input_iterator InputIt>
+FrozenSList<T>::FrozenSList(InputIt First, InputIt Last)
+{
+	m_Blocks.clear();
+
+	value_type Values[Block::Size];
+	size_type NumberOfValues = 0;
+
+	for (; First != Last; ++First)
+	{
+		Values[NumberOfValues++] = *First;
+
+		if (NumberOfValues == Block::Size)
+		{
+			AppendBlock(Values, NumberOfValues);
+			NumberOfValues = 0;
+		}
+	}
+
+	if (NumberOfValues > 0) AppendBlock(Values, NumberOfValues);
+
+	// The empty block ending the list, and the padding words: iterators advancing past the last element read the bits following it.
+	m_Blocks.push_back(Block{ value_type(), m_BitCount, 0 });
+	m_Words.resize(m_Words.size() + 2, 0);
+
+	m_Blocks.shrink_to_fit();
+	m_Words.shrink_to_fit();
+}
+
+template<typename T>
+FrozenSList<T>::FrozenSList(FrozenSList<value_type>&& That) : FrozenSList<value_type>()
+{
+	*this = std::move(That);
+}
+
+
+
+// That takes this list's blocks, then drops all of them but one, which becomes its empty block: no allocation is needed.
+template<typename T>
+auto FrozenSList<T>::operator= (FrozenSList<value_type>&& That) noexcept -> FrozenSList<value_type>&
+{
+	if (this != &That)
+	{
+		m_Blocks.swap(That.m_Blocks);
+		m_Words.swap(That.m_Words);
+		m_BitCount = std::exchange(That.m_BitCount, 0);
+		m_Size = std::exchange(That.m_Size, 0);
+
+		That.m_Blocks.erase(That.m_Blocks.begin() + 1, That.m_Blocks.end());
+		That.m_Blocks.front() = Block{};
+		std::vector<Word>().swap(That.m_Words);
+	}
+
+	return *this;
+}
+
+
+
+
+template<typename T>
+template<typename Func>
+void FrozenSList<T>::for_each(Func&& Function) const
+{
+	Word Codes[Block::Size];
+
+	for (size_type First = 0; First < m_Size; First += Block::Size)
+	{
+		const Block& Current = m_Blocks[First / Block::Size];
+		const size_type NumberOfValues = std::min(Block::Size, m_Size - First);
+		const Word Mask = Block::Mask(Current.Width);
+
+		// The codes don't depend on each other, so they're all unpacked before adding them up.
+		for (size_type i = 1; i < NumberOfValues; ++i)
+		{
+			Codes[i] = Block::Read(m_Words.data(), Current.BitOffset + (i - 1) * Current.Width, Mask);
+		}
+
+		value_type Value = Current.First;
+		Function(Value);
+
+		for (size_type i = 1; i < NumberOfValues; ++i)
+		{
+			Value = Block::Decode(Value, Codes[i]);
+			Function(Value);
+		}
+	}
+}
+
+
+
+
+template<typename T>
+void FrozenSList<T>::AppendBlock(const value_type* Values, size_type NumberOfValues)
+{
+	Word Codes[Block::Size];
+	Word AllCodes = 0;
+
+	for (size_type i = 1; i < NumberOfValues; ++i)
+	{
+		Codes[i] = Block::Encode(Values[i - 1], Values[i]);
+		AllCodes |= Codes[i];
+	}
+
+	// The widest code sets the highest bit of AllCodes.
+	const unsigned int Width = static_cast<unsigned int>(std::bit_width(AllCodes));
+	m_Blocks.push_back(Block{ Values[0], m_BitCount, Width });
+
+	for (size_type i = 1; i < NumberOfValues; ++i)
+	{
+		AppendBits(Codes[i], Width);
+	}
+
+	m_Size += NumberOfValues;
+}
+
+template<typename T>
+void FrozenSList<T>::AppendBits(Word Bits, unsigned int Width)
+{
+	if (Width == 0) return;
+
+	const unsigned int Shift = static_cast<unsigned int>(m_BitCount % 64);
+
+	if (Shift == 0) m_Words.push_back(Bits);
+	else
+	{
+		m_Words.back() |= Bits << Shift;
+		if (Shift + Width > 64) m_Words.push_back(Bits >> (64 - Shift));
+	}
+
+	m_BitCount += Width;
+}
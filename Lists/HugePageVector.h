@@ -0,0 +1,323 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+
+/**
+ * Growable array storing its elements in 2 MiB aligned buffers, backed by transparent huge pages where available.
+ *
+ * It implements the subset of std::vector used by SListArray, so it can replace its default storage: SListArray<T, HugePageVector<T>>.
+ * Meant for very large lists, whose traversals would otherwise be dominated by TLB misses.
+ *
+ * On Linux buffers are mapped with mmap, aligned to 2 MiB and marked with madvise(MADV_HUGEPAGE).
+ * When Prefault is true, buffers are also faulted in as soon as they're mapped, moving the cost of the first touch of each page out of push_front().
+ * Trivially copyable elements are relocated with mremap when the buffer grows, moving the pages instead of copying them.
+ *
+ * Everywhere else, buffers are allocated with the aligned operator new, and elements are always moved.
+ *
+ * @see SListArray
+ */
+template<typename T, bool Prefault = false>
+class HugePageVector final
+{
+public:
+
+	using value_type = T;
+	using size_type  = std::size_t;
+
+	static constexpr size_type HugePageSize = size_type(2) * 1024 * 1024;
+
+
+	HugePageVector() = default;
+	HugePageVector(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+	HugePageVector(const HugePageVector<value_type, Prefault>& That);
+	HugePageVector(HugePageVector<value_type, Prefault>&& That) noexcept;
+	~HugePageVector();
+
+
+	HugePageVector<value_type, Prefault>& operator= (HugePageVector<value_type, Prefault> That) noexcept; // copy-and-swap idiom.
+
+
+	inline value_type* data() noexcept { return m_Data; }
+	inline const value_type* data() const noexcept { return m_Data; }
+
+	inline value_type& back() { return m_Data[m_Size - 1]; }
+	inline const value_type& back() const { return m_Data[m_Size - 1]; }
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	template<std::input_iterator InputIt> void assign(InputIt First, InputIt Last);
+	void push_back(const value_type& Value);
+	void pop_back();
+	void reserve(size_type NumberOfElements);
+	void clear() noexcept;
+	void swap(HugePageVector<value_type, Prefault>& That) noexcept;
+
+	inline size_type size() const noexcept { return m_Size; }
+	inline size_type capacity() const noexcept { return m_Capacity; }
+	inline size_type max_size() const noexcept { return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(value_type); }
+
+private:
+
+	// Buffer sizes are always a multiple of HugePageSize.
+	static size_type BufferBytes(size_type NumberOfElements) noexcept;
+
+	static value_type* AllocateBuffer(size_type Bytes);
+	static void FreeBuffer(value_type* Buffer, size_type Bytes) noexcept;
+	static void PrefaultBuffer(void* Buffer, size_type Bytes) noexcept;
+
+	void Grow(size_type MinimumCapacity);
+
+	value_type* m_Data = nullptr;
+	size_type m_Size = 0;
+	size_type m_Capacity = 0;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T, bool Prefault>
+HugePageVector<T, Prefault>::HugePageVector(const HugePageVector<value_type, Prefault>& That) { assign(That.m_Data, That.m_Data + That.m_Size); }
+
+template<typename T, bool Prefault>
+HugePageVector<T, Prefault>::HugePageVector(HugePageVector<value_type, Prefault>&& That) noexcept
+	: m_Data(That.m_Data), m_Size(That.m_Size), m_Capacity(That.m_Capacity)
+{
+	That.m_Data = nullptr;
+	That.m_Size = 0;
+	That.m_Capacity = 0;
+}
+
+template<typename T, bool Prefault>
+HugePageVector<T, Prefault>::~HugePageVector()
+{
+	clear();
+	if (m_Data != nullptr) FreeBuffer(m_Data, BufferBytes(m_Capacity));
+}
+
+
+
+template<typename T, bool Prefault>
+auto HugePageVector<T, Prefault>::operator= (HugePageVector<value_type, Prefault> That) noexcept -> HugePageVector<value_type, Prefault>&
+{
+	swap(That);
+	return *this;
+}
+
+
+
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	clear();
+	reserve(NumberOfElements);
+
+	std::uninitialized_fill_n(m_Data, NumberOfElements, BaseValue);
+	m_Size = NumberOfElements;
+}
+
+template<typename T, bool Prefault>
+template<std::input_iterator InputIt>
+void HugePageVector<T, Prefault>::assign(InputIt First, InputIt Last)
+{
+	clear();
+
+	// Single pass ranges can't be measured beforehand: they're pushed one element at a time instead.
+	if constexpr (std::forward_iterator<InputIt>)
+	{
+		reserve(static_cast<size_type>(std::distance(First, Last)));
+		m_Size = static_cast<size_type>(std::uninitialized_copy(First, Last, m_Data) - m_Data);
+	}
+	else
+	{
+		for (; First != Last; ++First) push_back(*First);
+	}
+}
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::push_back(const value_type& Value)
+{
+	if (m_Size == m_Capacity) Grow(m_Size + 1);
+
+	::new (static_cast<void*>(m_Data + m_Size)) value_type(Value);
+	++m_Size;
+}
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::pop_back()
+{
+	--m_Size;
+	std::destroy_at(m_Data + m_Size);
+}
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::reserve(size_type NumberOfElements)
+{
+	if (NumberOfElements > m_Capacity) Grow(NumberOfElements);
+}
+
+// Keeps the buffer, just like std::vector does.
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::clear() noexcept
+{
+	std::destroy_n(m_Data, m_Size);
+	m_Size = 0;
+}
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::swap(HugePageVector<value_type, Prefault>& That) noexcept
+{
+	std::swap(m_Data, That.m_Data);
+	std::swap(m_Size, That.m_Size);
+	std::swap(m_Capacity, That.m_Capacity);
+}
+
+
+
+template<typename T, bool Prefault>
+auto HugePageVector<T, Prefault>::BufferBytes(size_type NumberOfElements) noexcept -> size_type
+{
+	const size_type Bytes = NumberOfElements * sizeof(value_type);
+	return (Bytes + HugePageSize - 1) / HugePageSize * HugePageSize;
+}
+
+#ifdef __linux__
+
+template<typename T, bool Prefault>
+T* HugePageVector<T, Prefault>::AllocateBuffer(size_type Bytes)
+{
+	// mmap only guarantees 4 KiB alignment: one more huge page is mapped, then the unaligned head and the tail are unmapped.
+	const size_type MappedBytes = Bytes + HugePageSize;
+
+	void* Mapping = mmap(nullptr, MappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (Mapping == MAP_FAILED) throw std::bad_alloc();
+
+	const std::uintptr_t MappingAddress = reinterpret_cast<std::uintptr_t>(Mapping);
+	const std::uintptr_t AlignedAddress = (MappingAddress + HugePageSize - 1) / HugePageSize * HugePageSize;
+
+	const size_type HeadBytes = AlignedAddress - MappingAddress;
+	const size_type TailBytes = MappedBytes - HeadBytes - Bytes;
+
+	if (HeadBytes > 0) munmap(Mapping, HeadBytes);
+	if (TailBytes > 0) munmap(reinterpret_cast<void*>(AlignedAddress + Bytes), TailBytes);
+
+	void* Buffer = reinterpret_cast<void*>(AlignedAddress);
+	madvise(Buffer, Bytes, MADV_HUGEPAGE);
+
+	return static_cast<value_type*>(Buffer);
+}
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::FreeBuffer(value_type* Buffer, size_type Bytes) noexcept
+{
+	munmap(Buffer, Bytes);
+}
+
+#else
+
+template<typename T, bool Prefault>
+T* HugePageVector<T, Prefault>::AllocateBuffer(size_type Bytes)
+{
+	return static_cast<value_type*>(::operator new(Bytes, std::align_val_t(HugePageSize)));
+}
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::FreeBuffer(value_type* Buffer, size_type Bytes) noexcept
+{
+	::operator delete(Buffer, Bytes, std::align_val_t(HugePageSize));
+}
+
+#endif
+
+// MAP_POPULATE would fault the pages in before madvise(), as small pages: they're faulted in afterwards instead.
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::PrefaultBuffer(void* Buffer, size_type Bytes) noexcept
+{
+	if constexpr (Prefault)
+	{
+#ifdef MADV_POPULATE_WRITE
+		if (madvise(Buffer, Bytes, MADV_POPULATE_WRITE) == 0) return;
+#endif
+
+		for (size_type Offset = 0; Offset < Bytes; Offset += 4096) static_cast<volatile char*>(Buffer)[Offset] = 0;
+	}
+}
+
+template<typename T, bool Prefault>
+void HugePageVector<T, Prefault>::Grow(size_type MinimumCapacity)
+{
+	const size_type OldBytes = BufferBytes(m_Capacity);
+	const size_type NewBytes = BufferBytes(std::max(MinimumCapacity, m_Capacity * 2));
+
+	value_type* NewData = AllocateBuffer(NewBytes);
+
+#ifdef __linux__
+	if constexpr (std::is_trivially_copyable_v<value_type>)
+	{
+		// Moves the old pages over the start of the new buffer, which keeps its alignment: no element is copied.
+		if (m_Data != nullptr && mremap(m_Data, OldBytes, OldBytes, MREMAP_MAYMOVE | MREMAP_FIXED, NewData) != MAP_FAILED)
+		{
+			madvise(NewData, NewBytes, MADV_HUGEPAGE);
+			PrefaultBuffer(reinterpret_cast<char*>(NewData) + OldBytes, NewBytes - OldBytes);
+
+			m_Data = NewData;
+			m_Capacity = NewBytes / sizeof(value_type);
+			return;
+		}
+	}
+#endif
+
+	PrefaultBuffer(NewData, NewBytes);
+
+	if constexpr (std::is_nothrow_move_constructible_v<value_type>)
+	{
+		std::uninitialized_move_n(m_Data, m_Size, NewData);
+	}
+	else
+	{
+		try
+		{
+			std::uninitialized_copy_n(m_Data, m_Size, NewData);
+		}
+		catch (...)
+		{
+			FreeBuffer(NewData, NewBytes);
+			throw;
+		}
+	}
+
+	std::destroy_n(m_Data, m_Size);
+	if (m_Data != nullptr) FreeBuffer(m_Data, OldBytes);
+
+	m_Data = NewData;
+	m_Capacity = NewBytes / sizeof(value_type);
+}
+
+
+
+
+namespace std
+{
+	template<typename T, bool Prefault>
+	void swap(HugePageVector<T, Prefault>& A, HugePageVector<T, Prefault>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,411 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SNode.h"
+#include "SListCore.h"
+#include "SIterator.h"
+
+
+/**
+ * Forward List of unique values, compatible with stl and its algorithms.
+ *
+ * Links its values in a chain of SNodes, just like SList, but also keeps an open addressing hash index alongside it, mapping each value to its node
+ * and to the node preceding it: contains(), find() and erase() of a value are O(1) on average, instead of a linear walk of the chain.
+ * The index uses linear probing on a power of two table, kept at most half full, and backward shift deletion, so it never needs tombstones.
+ * Each slot caches the hash of its value, so growing the table never calls Hash again, and most mismatching slots are skipped without reading their node.
+ *
+ * push_front() and pop_front() stay O(1), also updating the predecessor of the node following the pushed or popped one, and the order of the values
+ * is the one of the chain, never the one of the index.
+ * A value already in the list isn't pushed again: push_front() returns whether it was.
+ *
+ * Values can't be modified in place, since that would leave them in the wrong slot: both its iterators are ConstSIterators.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SList, SNode, ConstSIterator
+ */
+template<typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class IndexedSList final
+{
+	using Node = SNode<T>;
+
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using hasher           = Hash;
+	using key_equal        = KeyEqual;
+	using reference        = const T&;
+	using const_reference  = const T&;
+	using pointer          = const T*;
+	using const_pointer    = const T*;
+	using iterator         = ConstSIterator<value_type>;
+	using const_iterator   = ConstSIterator<value_type>;
+
+
+	IndexedSList() = default;
+	IndexedSList(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> IndexedSList(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
+	IndexedSList(const IndexedSList<value_type, hasher, key_equal>& That);
+	IndexedSList(IndexedSList<value_type, hasher, key_equal>&& That) noexcept;
+	~IndexedSList();
+
+
+	IndexedSList<value_type, hasher, key_equal>& operator= (IndexedSList<value_type, hasher, key_equal> That) noexcept; // copy-and-swap idiom.
+	IndexedSList<value_type, hasher, key_equal>& operator= (std::initializer_list<value_type> IL);
+
+
+	inline const_iterator begin() const noexcept { return cbegin(); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(FirstNode()); }
+
+	inline const_iterator end() const noexcept { return cend(); }
+	inline const_iterator cend() const noexcept { return const_iterator(); }
+
+
+	void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> void assign(InputIt First, InputIt Last);
+	// Both return false, leaving the list unchanged, when Value is already in it.
+	bool push_front(const value_type& Value);
+	bool push_back(const value_type& Value);
+	void pop_front();
+	// Returns the number of erased values: 0 or 1.
+	size_type erase(const value_type& Value);
+	void clear();
+	void swap(IndexedSList<value_type, hasher, key_equal>& That) noexcept;
+
+	const_iterator find(const value_type& Value) const;
+	inline bool contains(const value_type& Value) const { return !empty() && FindSlot(Value, HashOf(Value)).Element != nullptr; }
+
+	inline const_reference front() const { return FirstNode()->Data; }
+
+	inline bool empty() const { return m_Core.First() == nullptr; }
+	inline size_type size() const noexcept { return m_Core.Size(); }
+	inline size_type max_size() const noexcept { return static_cast<size_type>(std::numeric_limits<std::ptrdiff_t>::max()) / (sizeof(Node) + 2 * sizeof(Slot)); }
+	inline size_type bucket_count() const noexcept { return m_Slots.size(); }
+
+private:
+
+	// Element is nullptr for the empty slots. Predecessor is nullptr for the front of the list.
+	struct Slot
+	{
+		std::uint64_t HashCode = 0;
+		Node* Element = nullptr;
+		Node* Predecessor = nullptr;
+	};
+
+	static constexpr size_type MinimumBucketCount = 16;
+
+	inline Node* FirstNode() const noexcept { return static_cast<Node*>(m_Core.First()); }
+
+	// The user's hash is mixed with a multiplication, taking its highest bits as the home slot:
+	// hashes that only differ in their high bits, like std::hash of aligned pointers, still spread over the whole table.
+	inline std::uint64_t HashOf(const value_type& Value) const { return static_cast<std::uint64_t>(m_Hash(Value)) * 0x9E3779B97F4A7C15ull; }
+	inline size_type HomeOf(std::uint64_t Hashed) const noexcept { return static_cast<size_type>(Hashed >> m_Shift); }
+	inline size_type NextOf(size_type Index) const noexcept { return (Index + 1) & (m_Slots.size() - 1); }
+
+	// Returns the slot holding Value, or the empty one where probing stopped. The table must have been allocated, which any non empty list has.
+	Slot& FindSlot(const value_type& Value, std::uint64_t Hashed) const;
+	Slot& SlotOf(const Node* Existing) const { return FindSlot(Existing->Data, HashOf(Existing->Data)); }
+	void RemoveSlot(Slot& Removed) noexcept;
+	void Reserve(size_type NumberOfElements);
+
+	static void DestroyChain(SListLink* First) noexcept;
+
+	SListCore m_Core;
+	// Mutable only so that the const lookups can return a reference to a slot, the same function serving both the lookups and the updates.
+	mutable std::vector<Slot> m_Slots;
+	unsigned int m_Shift = 64;
+	hasher m_Hash;
+	key_equal m_KeyEqual;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T, typename Hash, typename KeyEqual>
+IndexedSList<T, Hash, KeyEqual>::IndexedSList(std::initializer_list<value_type> IL) { assign(IL); }
+
+template<typename T, typename Hash, typename KeyEqual>
+template<std::input_iterator InputIt>
+IndexedSList<T, Hash, KeyEqual>::IndexedSList(InputIt First, InputIt Last) { assign(First, Last); }
+
+// The values are already unique, so the index is sized once and each of them is linked at the back, without looking for duplicates.
+template<typename T, typename Hash, typename KeyEqual>
+IndexedSList<T, Hash, KeyEqual>::IndexedSList(const IndexedSList<value_type, hasher, key_equal>& That) : m_Hash(That.m_Hash), m_KeyEqual(That.m_KeyEqual)
+{
+	Reserve(That.size());
+
+	for (Node* That_CurrentNode = That.FirstNode(); That_CurrentNode != nullptr; That_CurrentNode = That_CurrentNode->NextNode())
+	{
+		Node* const Predecessor = static_cast<Node*>(m_Core.Last());
+		const std::uint64_t Hashed = HashOf(That_CurrentNode->Data);
+
+		Node* NewNode = new Node(nullptr, That_CurrentNode->Data);
+		m_Core.PushBack(NewNode);
+		FindSlot(NewNode->Data, Hashed) = Slot{ Hashed, NewNode, Predecessor };
+	}
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+IndexedSList<T, Hash, KeyEqual>::IndexedSList(IndexedSList<value_type, hasher, key_equal>&& That) noexcept
+	: m_Core(std::move(That.m_Core)), m_Slots(std::move(That.m_Slots)), m_Shift(That.m_Shift), m_Hash(That.m_Hash), m_KeyEqual(That.m_KeyEqual)
+{
+	That.m_Slots.clear();
+	That.m_Shift = 64;
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+IndexedSList<T, Hash, KeyEqual>::~IndexedSList() { DestroyChain(m_Core.Release()); }
+
+
+
+
+template<typename T, typename Hash, typename KeyEqual>
+auto IndexedSList<T, Hash, KeyEqual>::operator= (IndexedSList<value_type, hasher, key_equal> That) noexcept -> IndexedSList<value_type, hasher, key_equal>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+auto IndexedSList<T, Hash, KeyEqual>::operator= (std::initializer_list<value_type> IL) -> IndexedSList<value_type, hasher, key_equal>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T, typename Hash, typename KeyEqual>
+void IndexedSList<T, Hash, KeyEqual>::assign(std::initializer_list<value_type> IL)
+{
+	clear();
+	Reserve(IL.size());
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+template<std::input_iterator InputIt>
+void IndexedSList<T, Hash, KeyEqual>::assign(InputIt First, InputIt Last)
+{
+	clear();
+
+	if constexpr (std::forward_iterator<InputIt>)
+	{
+		Reserve(static_cast<size_type>(std::distance(First, Last)));
+	}
+
+	for (; First != Last; ++First)
+	{
+		push_back(*First);
+	}
+}
+
+
+template<typename T, typename Hash, typename KeyEqual>
+bool IndexedSList<T, Hash, KeyEqual>::push_front(const value_type& Value)
+{
+	Reserve(size() + 1);
+
+	const std::uint64_t Hashed = HashOf(Value);
+	Slot& Free = FindSlot(Value, Hashed);
+	if (Free.Element != nullptr) return false;
+
+	// Filling an empty slot never moves the others, so Free stays valid while the old front's slot is looked up.
+	Node* NewNode = new Node(nullptr, Value);
+	Free = Slot{ Hashed, NewNode, nullptr };
+
+	if (!empty()) SlotOf(FirstNode()).Predecessor = NewNode;
+	m_Core.PushFront(NewNode);
+	return true;
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+bool IndexedSList<T, Hash, KeyEqual>::push_back(const value_type& Value)
+{
+	Reserve(size() + 1);
+
+	const std::uint64_t Hashed = HashOf(Value);
+	Slot& Free = FindSlot(Value, Hashed);
+	if (Free.Element != nullptr) return false;
+
+	Node* NewNode = new Node(nullptr, Value);
+	Free = Slot{ Hashed, NewNode, static_cast<Node*>(m_Core.Last()) };
+
+	m_Core.PushBack(NewNode);
+	return true;
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+void IndexedSList<T, Hash, KeyEqual>::pop_front()
+{
+	// Just like SList's, popping from an empty list does nothing: there's no slot to remove, and the table may not even be allocated.
+	if (empty()) return;
+
+	Node* OldFirst = FirstNode();
+
+	RemoveSlot(SlotOf(OldFirst));
+	m_Core.PopFront();
+	if (!empty()) SlotOf(FirstNode()).Predecessor = nullptr;
+
+	delete OldFirst;
+}
+
+// The predecessor found in the slot unlinks the node in O(1), then becomes the predecessor of the node following it.
+template<typename T, typename Hash, typename KeyEqual>
+auto IndexedSList<T, Hash, KeyEqual>::erase(const value_type& Value) -> size_type
+{
+	if (empty()) return 0;
+
+	Slot& Found = FindSlot(Value, HashOf(Value));
+	if (Found.Element == nullptr) return 0;
+
+	Node* const Erased = Found.Element;
+	Node* const Predecessor = Found.Predecessor;
+	RemoveSlot(Found);
+
+	if (Predecessor == nullptr) m_Core.PopFront();
+	else m_Core.EraseAfter(Predecessor);
+
+	if (Erased->Next != nullptr) SlotOf(Erased->NextNode()).Predecessor = Predecessor;
+
+	delete Erased;
+	return 1;
+}
+
+// The table keeps its size, so a cleared list can be filled again without growing it.
+template<typename T, typename Hash, typename KeyEqual>
+void IndexedSList<T, Hash, KeyEqual>::clear()
+{
+	DestroyChain(m_Core.Release());
+	std::fill(m_Slots.begin(), m_Slots.end(), Slot());
+}
+
+template<typename T, typename Hash, typename KeyEqual>
+void IndexedSList<T, Hash, KeyEqual>::swap(IndexedSList<value_type, hasher, key_equal>& That) noexcept
+{
+	m_Core.Swap(That.m_Core);
+	std::swap(m_Slots, That.m_Slots);
+	std::swap(m_Shift, That.m_Shift);
+	std::swap(m_Hash, That.m_Hash);
+	std::swap(m_KeyEqual, That.m_KeyEqual);
+}
+
+
+template<typename T, typename Hash, typename KeyEqual>
+auto IndexedSList<T, Hash, KeyEqual>::find(const value_type& Value) const -> const_iterator
+{
+	return empty() ? cend() : const_iterator(FindSlot(Value, HashOf(Value)).Element);
+}
+
+
+
+
+template<typename T, typename Hash, typename KeyEqual>
+auto IndexedSList<T, Hash, KeyEqual>::FindSlot(const value_type& Value, std::uint64_t Hashed) const -> Slot&
+{
+	size_type Index = HomeOf(Hashed);
+
+	while (m_Slots[Index].Element != nullptr)
+	{
+		if (m_Slots[Index].HashCode == Hashed && m_KeyEqual(m_Slots[Index].Element->Data, Value)) break;
+		Index = NextOf(Index);
+	}
+
+	return m_Slots[Index];
+}
+
+// Backward shift deletion: the following slots of the same cluster are moved back into the hole, unless it'd put them before their home slot.
+template<typename T, typename Hash, typename KeyEqual>
+void IndexedSList<T, Hash, KeyEqual>::RemoveSlot(Slot& Removed) noexcept
+{
+	const size_type Mask = m_Slots.size() - 1;
+	size_type Hole = static_cast<size_type>(&Removed - m_Slots.data());
+
+	for (size_type Index = NextOf(Hole); m_Slots[Index].Element != nullptr; Index = NextOf(Index))
+	{
+		// Distances are computed modulo the table size, so the cluster may wrap around its end.
+		const size_type Home = HomeOf(m_Slots[Index].HashCode);
+		if (((Index - Home) & Mask) < ((Index - Hole) & Mask)) continue;
+
+		m_Slots[Hole] = m_Slots[Index];
+		Hole = Index;
+	}
+
+	m_Slots[Hole] = Slot();
+}
+
+// Grows the table to the smallest power of two keeping it at most half full, moving each slot by its cached hash.
+template<typename T, typename Hash, typename KeyEqual>
+void IndexedSList<T, Hash, KeyEqual>::Reserve(size_type NumberOfElements)
+{
+	if (NumberOfElements * 2 <= m_Slots.size()) return;
+
+	size_type NewBucketCount = std::max(MinimumBucketCount, m_Slots.size());
+	while (NewBucketCount < NumberOfElements * 2) NewBucketCount *= 2;
+
+	std::vector<Slot> OldSlots(NewBucketCount);
+	std::swap(m_Slots, OldSlots);
+	m_Shift = 64 - static_cast<unsigned int>(std::countr_zero(NewBucketCount));
+
+	for (const Slot& Moved : OldSlots)
+	{
+		if (Moved.Element == nullptr) continue;
+
+		size_type Index = HomeOf(Moved.HashCode);
+		while (m_Slots[Index].Element != nullptr) Index = NextOf(Index);
+		m_Slots[Index] = Moved;
+	}
+}
+
+
+// Same as SList: trivially destructible values let SListCore free the whole chain, given just the size of the nodes.
+template<typename T, typename Hash, typename KeyEqual>
+void IndexedSList<T, Hash, KeyEqual>::DestroyChain(SListLink* First) noexcept
+{
+	if constexpr (std::is_trivially_destructible_v<value_type> && alignof(Node) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	{
+		SListCore::DeallocateChain(First, sizeof(Node));
+	}
+	else
+	{
+		while (First != nullptr)
+		{
+			SListLink* Next = First->Next;
+			delete static_cast<Node*>(First);
+			First = Next;
+		}
+	}
+}
+
+
+
+
+namespace std
+{
+	template<typename T, typename Hash, typename KeyEqual>
+	void swap(IndexedSList<T, Hash, KeyEqual>& A, IndexedSList<T, Hash, KeyEqual>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,111 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+
+/**
+ * Simple support class used by SList and SListArray, to merge many sorted sequences at once.
+ *
+ * Keeps a pointer to the current head of each source, nullptr once the source is exhausted, and a tournament tree over them:
+ * each internal node stores the loser of the match played there, and the root the overall winner, the smallest head.
+ * After the winner's head is consumed and replaced, only the matches along its path to the root are replayed, comparing it
+ * against the stored losers: log2(number of sources) comparisons per element, instead of one per source.
+ *
+ * Ties are won by the source with the lowest index, so merging is stable. There must be at least one source.
+ *
+ * @see SList, SListArray
+ */
+template<typename T, typename Compare>
+class LoserTree final
+{
+public:
+
+	inline LoserTree(std::size_t NumberOfSources, Compare Comp) : m_Tree(NumberOfSources), m_Comp(Comp) { }
+
+
+	// Sets the head of Source, before the tree is built.
+	inline void Set(std::size_t Source, const T* Head) { m_Tree[Source] = Entry{ Head, Source }; }
+
+	void Build();
+
+	inline std::size_t Winner() const { return m_Tree[0].Source; }
+	inline bool Exhausted() const { return m_Tree[0].Head == nullptr; }
+
+	// Replaces the head of the winner, then finds the new one.
+	void Replace(const T* Head);
+
+private:
+
+	// Each node keeps the head of its source along with it, so a match reads a single node, without going through the source.
+	struct Entry
+	{
+		const T* Head = nullptr;
+		std::size_t Source = 0;
+	};
+
+	// Both comparisons are always made, and combined without branching: ties are won by the lower source.
+	inline bool Beats(const Entry& A, const Entry& B) const
+	{
+		if (A.Head == nullptr) return false;
+		if (B.Head == nullptr) return true;
+
+		const bool Smaller = m_Comp(*A.Head, *B.Head);
+		const bool Greater = m_Comp(*B.Head, *A.Head);
+		return Smaller | (!Greater & (A.Source < B.Source));
+	}
+
+	// Leaves are numbered after the internal nodes, from NumberOfSources on, just like in a binary heap, but they aren't stored:
+	// m_Tree[0] is the winner, the other nodes the losers of their matches.
+	std::vector<Entry> m_Tree;
+	Compare m_Comp;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+// Plays every match bottom up, keeping the winners aside to play the matches above.
+template<typename T, typename Compare>
+void LoserTree<T, Compare>::Build()
+{
+	const std::size_t NumberOfSources = m_Tree.size();
+
+	std::vector<Entry> Winners(2 * NumberOfSources);
+	std::copy(m_Tree.begin(), m_Tree.end(), Winners.begin() + NumberOfSources);
+
+	for (std::size_t Node = NumberOfSources - 1; Node > 0; --Node)
+	{
+		const Entry& Left = Winners[2 * Node];
+		const Entry& Right = Winners[2 * Node + 1];
+
+		const bool LeftWins = Beats(Left, Right);
+		m_Tree[Node] = LeftWins ? Right : Left;
+		Winners[Node] = LeftWins ? Left : Right;
+	}
+
+	m_Tree[0] = NumberOfSources > 1 ? Winners[1] : Winners[NumberOfSources];
+}
+
+// The outcome of each match is random for random inputs: indexing the two players with it, instead of branching on it, avoids mispredictions.
+template<typename T, typename Compare>
+void LoserTree<T, Compare>::Replace(const T* Head)
+{
+	Entry Winner{ Head, m_Tree[0].Source };
+
+	for (std::size_t Node = (m_Tree.size() + Winner.Source) / 2; Node > 0; Node /= 2)
+	{
+		const Entry Players[2] = { Winner, m_Tree[Node] };
+		const bool LoserWins = Beats(Players[1], Players[0]);
+
+		m_Tree[Node] = Players[!LoserWins];
+		Winner = Players[LoserWins];
+	}
+
+	m_Tree[0] = Winner;
+}
@@ -0,0 +1,245 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include "PackedWords.h"
+#include "PackedSIterator.h"
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * A variant of FixedSList storing each element in Bits bits of a C-style array of 64 bit words, where the element with the highest index is the first on the list.
+ * Just like FixedSList, its push_front() discards the values exceeding the capacity, and every operation is constexpr.
+ * FixedSList<bool, Capacity> is a PackedFixedSList<bool, 1, Capacity>, taking one bit per flag instead of a byte.
+ *
+ * T must be convertible to and from an unsigned integer with static_cast, and its values must fit in Bits bits: bool, enums and small unsigned integers.
+ *
+ * Uses a custom forward iterator class, called PackedSIterator, which returns the elements through a proxy reference, since they don't have an address of their own.
+ * count() and find() compare a whole word at a time, so they're much faster than the std algorithms, which extract the elements one by one.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see FixedSList, PackedSIterator, PackedWords
+ */
+template<typename T, unsigned Bits, std::size_t Capacity = 1000>
+class PackedFixedSList
+{
+	using Words = PackedWords<T, Bits>;
+
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = PackedSReference<T, Bits>;
+	using const_reference  = T;
+	using iterator         = PackedSIterator<value_type, Bits>;
+	using const_iterator   = ConstPackedSIterator<value_type, Bits>;
+
+
+	constexpr PackedFixedSList();
+	constexpr PackedFixedSList(size_type NumberOfElements);
+	constexpr PackedFixedSList(size_type NumberOfElements, const value_type& BaseValue);
+	constexpr PackedFixedSList(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> constexpr PackedFixedSList(InputIt First, InputIt Last);
+	constexpr PackedFixedSList(const PackedFixedSList<value_type, Bits, Capacity>& That);
+	// There isn't a move constructor, because there aren't dynamic allocations.
+	constexpr ~PackedFixedSList() = default;
+
+
+	constexpr PackedFixedSList<value_type, Bits, Capacity>& operator= (const PackedFixedSList<value_type, Bits, Capacity>& That);
+	constexpr PackedFixedSList<value_type, Bits, Capacity>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+
+	constexpr iterator begin() noexcept { return iterator(m_Words, m_LastElementIndex); }
+	constexpr const_iterator cbegin() const noexcept { return const_iterator(const_cast<typename Words::Word*>(m_Words), m_LastElementIndex); }
+
+	constexpr iterator end() noexcept { return iterator(m_Words, -1); }
+	constexpr const_iterator cend() const noexcept { return const_iterator(const_cast<typename Words::Word*>(m_Words), -1); }
+
+
+	constexpr void assign(size_type NumberOfElements, const value_type& BaseValue);
+	constexpr void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> constexpr void assign(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
+	constexpr void push_front(const value_type& Value);
+	constexpr void pop_front();
+	constexpr void clear();
+	constexpr void swap(PackedFixedSList<value_type, Bits, Capacity>& That) noexcept;
+
+	constexpr reference front() { return reference(m_Words, m_LastElementIndex); }
+	constexpr const_reference front() const { return Words::Get(m_Words, m_LastElementIndex); }
+
+	// Word at a time.
+	constexpr size_type count(const value_type& Value) const { return Words::Count(m_Words, size(), Value); }
+	constexpr iterator find(const value_type& Value) { return iterator(m_Words, Words::FindLast(m_Words, size(), Value)); }
+	constexpr const_iterator find(const value_type& Value) const { return const_iterator(const_cast<typename Words::Word*>(m_Words), Words::FindLast(m_Words, size(), Value)); }
+
+	constexpr bool empty() const { return m_LastElementIndex < 0; }
+	constexpr size_type size() const noexcept { return static_cast<size_type>(m_LastElementIndex + 1); }
+	constexpr size_type max_size() const noexcept { return Capacity; }
+
+private:
+
+	using index_type = typename Words::Index;
+
+	static constexpr size_type NumberOfWords = Words::WordsFor(Capacity) > 0 ? Words::WordsFor(Capacity) : 1;
+
+	constexpr void CopyWordsFrom(const PackedFixedSList<value_type, Bits, Capacity>& That);
+
+	typename Words::Word m_Words[NumberOfWords]; // Just like FixedSList's array, initialized only during constant evaluation.
+	index_type m_LastElementIndex = -1;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr PackedFixedSList<T, Bits, Capacity>::PackedFixedSList()
+{
+	// A constant expression cannot hold indeterminate values, so the words are initialized only when constant evaluated.
+	if (std::is_constant_evaluated())
+	{
+		for (typename Words::Word& Slot : m_Words) Slot = 0;
+	}
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr PackedFixedSList<T, Bits, Capacity>::PackedFixedSList(size_type NumberOfElements)
+	: PackedFixedSList<value_type, Bits, Capacity>(NumberOfElements, value_type()) { }
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr PackedFixedSList<T, Bits, Capacity>::PackedFixedSList(size_type NumberOfElements, const value_type& BaseValue)
+	: PackedFixedSList<value_type, Bits, Capacity>() { assign(NumberOfElements, BaseValue); }
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr PackedFixedSList<T, Bits, Capacity>::PackedFixedSList(std::initializer_list<value_type> IL)
+	: PackedFixedSList<value_type, Bits, Capacity>() { assign(IL); }
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+template<std::input_iterator InputIt>
+constexpr PackedFixedSList<T, Bits, Capacity>::PackedFixedSList(InputIt First, InputIt Last)
+	: PackedFixedSList<value_type, Bits, Capacity>() { assign(First, Last); }
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr PackedFixedSList<T, Bits, Capacity>::PackedFixedSList(const PackedFixedSList<value_type, Bits, Capacity>& That)
+	: PackedFixedSList<value_type, Bits, Capacity>()
+{
+	CopyWordsFrom(That);
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr auto PackedFixedSList<T, Bits, Capacity>::operator= (const PackedFixedSList<value_type, Bits, Capacity>& That) -> PackedFixedSList<value_type, Bits, Capacity>&
+{
+	if (this != &That) CopyWordsFrom(That);
+	return *this;
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr auto PackedFixedSList<T, Bits, Capacity>::operator= (std::initializer_list<value_type> IL) -> PackedFixedSList<value_type, Bits, Capacity>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr void PackedFixedSList<T, Bits, Capacity>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	// Just like push_front, the values exceeding the capacity are discarded.
+	if (NumberOfElements > Capacity) NumberOfElements = Capacity;
+
+	// A word at a time.
+	Words::Fill(m_Words, NumberOfElements, BaseValue);
+	m_LastElementIndex = static_cast<index_type>(NumberOfElements) - 1;
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr void PackedFixedSList<T, Bits, Capacity>::assign(std::initializer_list<value_type> IL)
+{
+	clear();
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+// Only the first Capacity elements of the range are kept, then the fields are reversed in place, so that its first element ends up at the highest index.
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+template<std::input_iterator InputIt>
+constexpr void PackedFixedSList<T, Bits, Capacity>::assign(InputIt First, InputIt Last)
+{
+	clear();
+
+	for (; First != Last && size() < Capacity; ++First)
+	{
+		push_front(*First);
+	}
+
+	Words::Reverse(m_Words, size());
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr void PackedFixedSList<T, Bits, Capacity>::push_front(const value_type& Value)
+{
+	if (m_LastElementIndex == static_cast<index_type>(Capacity) - 1) return;
+
+	++m_LastElementIndex;
+
+	// The words aren't initialized, so the first element of each one overwrites it entirely.
+	if (m_LastElementIndex % Words::FieldsPerWord == 0) m_Words[m_LastElementIndex / Words::FieldsPerWord] = Words::Encode(Value);
+	else Words::Set(m_Words, m_LastElementIndex, Value);
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr void PackedFixedSList<T, Bits, Capacity>::pop_front()
+{
+	--m_LastElementIndex;
+	if (m_LastElementIndex < 0) m_LastElementIndex = -1;
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr void PackedFixedSList<T, Bits, Capacity>::clear()
+{
+	m_LastElementIndex = -1;
+}
+
+// Only the used words are copied.
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr void PackedFixedSList<T, Bits, Capacity>::CopyWordsFrom(const PackedFixedSList<value_type, Bits, Capacity>& That)
+{
+	for (size_type i = 0; i < Words::WordsFor(That.size()); ++i) m_Words[i] = That.m_Words[i];
+	m_LastElementIndex = That.m_LastElementIndex;
+}
+
+template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+constexpr void PackedFixedSList<T, Bits, Capacity>::swap(PackedFixedSList<value_type, Bits, Capacity>& That) noexcept
+{
+	PackedFixedSList<value_type, Bits, Capacity> TmpList = That;
+	That = *this;
+	*this = TmpList;
+}
+
+
+
+
+namespace std
+{
+	template<typename T, unsigned Bits, std::size_t Capacity /*= 1000*/>
+	constexpr void swap(PackedFixedSList<T, Bits, Capacity>& A, PackedFixedSList<T, Bits, Capacity>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,411 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <vector>
+#include "PackedWords.h"
+#include "PackedSIterator.h"
+#include "LoserTree.h"
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * A variant of SListArray storing each element in Bits bits of a std vector of 64 bit words, where the element with the highest index is the first on the list.
+ * Meant for very long lists of flags or small codes: 1 bit elements take 64 times less memory than an SListArray<long long>, and 8 times less than an SListArray<bool>.
+ * SListArray<bool> is a PackedSListArray<bool, 1>.
+ *
+ * T must be convertible to and from an unsigned integer with static_cast, and its values must fit in Bits bits: bool, enums and small unsigned integers.
+ *
+ * Uses a custom forward iterator class, called PackedSIterator, which returns the elements through a proxy reference, since they don't have an address of their own.
+ * count() and find() compare a whole word at a time, so they're much faster than the std algorithms, which extract the elements one by one.
+ *
+ * It offers the same batch operations and merge() of SListArray: push_front_n() fills whole words at once, push_front_range() packs each word
+ * before storing it, and merge() unpacks the lists to merge them through a LoserTree, on a single thread.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SListArray, PackedSIterator, PackedWords
+ */
+template<typename T, unsigned Bits>
+class PackedSListArray
+{
+	using Words = PackedWords<T, Bits>;
+
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = PackedSReference<T, Bits>;
+	using const_reference  = T;
+	using iterator         = PackedSIterator<value_type, Bits>;
+	using const_iterator   = ConstPackedSIterator<value_type, Bits>;
+
+
+	PackedSListArray() = default;
+	PackedSListArray(size_type NumberOfElements);
+	PackedSListArray(size_type NumberOfElements, const value_type& BaseValue);
+	PackedSListArray(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> PackedSListArray(InputIt First, InputIt Last);
+	PackedSListArray(const PackedSListArray<value_type, Bits>& That) = default;
+	PackedSListArray(PackedSListArray<value_type, Bits>&& That) noexcept;
+	~PackedSListArray() = default;
+
+
+	PackedSListArray<value_type, Bits>& operator= (PackedSListArray<value_type, Bits> That) noexcept; // copy-and-swap idiom.
+	PackedSListArray<value_type, Bits>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+
+	inline iterator begin() noexcept { return iterator(m_Words.data(), LastElementIndex()); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<typename Words::Word*>(m_Words.data()), LastElementIndex()); }
+
+	inline iterator end() noexcept { return iterator(m_Words.data(), -1); }
+	inline const_iterator cend() const noexcept { return const_iterator(const_cast<typename Words::Word*>(m_Words.data()), -1); }
+
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> void assign(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
+	void push_front(const value_type& Value);
+	void pop_front();
+	// Both keep the order of the range: First becomes the front. The vector grows at most once.
+	template<std::input_iterator InputIt> void push_front_range(InputIt First, InputIt Last);
+	void push_front_n(size_type NumberOfElements, const value_type& Value);
+	// Writes at most NumberOfElements values to Output, in list order, and returns the iterator past the last one written.
+	template<std::output_iterator<T> OutputIt> OutputIt pop_front_n(size_type NumberOfElements, OutputIt Output);
+	// Both merge sorted lists into this sorted one, leaving them empty. Equal values keep the order of their lists, this one's first.
+	// Threads is only taken for compatibility with SListArray: the merge always runs on the calling thread.
+	template<typename Compare = std::less<T>> void merge(PackedSListArray<value_type, Bits>&& That, Compare Comp = Compare());
+	template<typename Compare = std::less<T>>
+	void merge(std::span<PackedSListArray<value_type, Bits>> Others, Compare Comp = Compare(), unsigned int Threads = 1);
+	void clear();
+	void swap(PackedSListArray<value_type, Bits>& That) noexcept;
+
+	inline reference front() { return reference(m_Words.data(), LastElementIndex()); }
+	inline const_reference front() const { return Words::Get(m_Words.data(), LastElementIndex()); }
+
+	// Word at a time.
+	inline size_type count(const value_type& Value) const { return Words::Count(m_Words.data(), m_Size, Value); }
+	inline iterator find(const value_type& Value) { return iterator(m_Words.data(), Words::FindLast(m_Words.data(), m_Size, Value)); }
+	inline const_iterator find(const value_type& Value) const { return const_iterator(const_cast<typename Words::Word*>(m_Words.data()), Words::FindLast(m_Words.data(), m_Size, Value)); }
+
+	inline bool empty() const { return m_Size == 0; }
+	inline size_type size() const noexcept { return m_Size; }
+	inline size_type max_size() const noexcept { return m_Words.max_size(); }
+	inline size_type capacity() const noexcept { return m_Words.capacity() * Words::FieldsPerWord; }
+
+protected:
+
+	// Implements merge() for spans of PackedSListArrays, or of lists deriving from it, like SListArray<bool>.
+	template<typename ListType, typename Compare> void MergeLists(std::span<ListType> Others, Compare Comp);
+
+private:
+
+	inline typename Words::Index LastElementIndex() const noexcept { return static_cast<typename Words::Index>(m_Size) - 1; }
+
+	// Appends the range after the element with the highest index, packing the fields of each word before storing it.
+	template<std::input_iterator InputIt> void AppendPacked(InputIt First, InputIt Last);
+
+	void Reserve(size_type NumberOfElements);
+
+	std::vector<typename Words::Word> m_Words;
+	size_type m_Size = 0;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T, unsigned Bits>
+PackedSListArray<T, Bits>::PackedSListArray(size_type NumberOfElements) : PackedSListArray<value_type, Bits>(NumberOfElements, value_type()) { }
+
+template<typename T, unsigned Bits>
+PackedSListArray<T, Bits>::PackedSListArray(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+
+template<typename T, unsigned Bits>
+PackedSListArray<T, Bits>::PackedSListArray(std::initializer_list<value_type> IL) { assign(IL); }
+
+template<typename T, unsigned Bits>
+template<std::input_iterator InputIt>
+PackedSListArray<T, Bits>::PackedSListArray(InputIt First, InputIt Last) { assign(First, Last); }
+
+template<typename T, unsigned Bits>
+PackedSListArray<T, Bits>::PackedSListArray(PackedSListArray<value_type, Bits>&& That) noexcept : m_Words(std::move(That.m_Words)), m_Size(That.m_Size)
+{
+	That.m_Size = 0;
+}
+
+
+
+template<typename T, unsigned Bits>
+auto PackedSListArray<T, Bits>::operator= (PackedSListArray<value_type, Bits> That) noexcept -> PackedSListArray<value_type, Bits>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T, unsigned Bits>
+auto PackedSListArray<T, Bits>::operator= (std::initializer_list<value_type> IL) -> PackedSListArray<value_type, Bits>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	// A word at a time.
+	m_Words.resize(Words::WordsFor(NumberOfElements));
+	Words::Fill(m_Words.data(), NumberOfElements, BaseValue);
+	m_Size = NumberOfElements;
+}
+
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::assign(std::initializer_list<value_type> IL)
+{
+	clear();
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+// The range is packed in its order, then the fields are reversed in place, so that its first element ends up at the highest index.
+template<typename T, unsigned Bits>
+template<std::input_iterator InputIt>
+void PackedSListArray<T, Bits>::assign(InputIt First, InputIt Last)
+{
+	clear();
+
+	if constexpr (std::forward_iterator<InputIt>) m_Words.reserve(Words::WordsFor(static_cast<size_type>(std::distance(First, Last))));
+
+	for (; First != Last; ++First)
+	{
+		push_front(*First);
+	}
+
+	Words::Reverse(m_Words.data(), m_Size);
+}
+
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::push_front(const value_type& Value)
+{
+	if (m_Size % Words::FieldsPerWord == 0) m_Words.push_back(0);
+
+	Words::Set(m_Words.data(), static_cast<typename Words::Index>(m_Size), Value);
+	++m_Size;
+}
+
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::pop_front()
+{
+	--m_Size;
+	if (m_Size % Words::FieldsPerWord == 0) m_Words.pop_back();
+}
+
+// Ranges which can be walked backwards are packed from their last element, the others are packed in their order, then reversed in place.
+template<typename T, unsigned Bits>
+template<std::input_iterator InputIt>
+void PackedSListArray<T, Bits>::push_front_range(InputIt First, InputIt Last)
+{
+	if constexpr (std::forward_iterator<InputIt>)
+	{
+		Reserve(m_Size + static_cast<size_type>(std::distance(First, Last)));
+	}
+
+	if constexpr (std::bidirectional_iterator<InputIt>)
+	{
+		AppendPacked(std::make_reverse_iterator(Last), std::make_reverse_iterator(First));
+	}
+	else
+	{
+		const size_type OldSize = m_Size;
+		AppendPacked(First, Last);
+
+		Words::Reverse(m_Words.data(), OldSize, m_Size);
+	}
+}
+
+// The word being filled is completed one field at a time, then the value is broadcast to whole words.
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::push_front_n(size_type NumberOfElements, const value_type& Value)
+{
+	Reserve(m_Size + NumberOfElements);
+
+	for (; NumberOfElements > 0 && m_Size % Words::FieldsPerWord != 0; --NumberOfElements) push_front(Value);
+
+	// The fields of the last word past the end of the list are never read, so it can be filled whole too.
+	const size_type NewWords = Words::WordsFor(NumberOfElements);
+	m_Words.insert(m_Words.end(), NewWords, Words::Broadcast(Value));
+	m_Size += NumberOfElements;
+}
+
+template<typename T, unsigned Bits>
+template<std::output_iterator<T> OutputIt>
+OutputIt PackedSListArray<T, Bits>::pop_front_n(size_type NumberOfElements, OutputIt Output)
+{
+	NumberOfElements = std::min(NumberOfElements, m_Size);
+
+	for (size_type i = 0; i < NumberOfElements; ++i)
+	{
+		*Output = Words::Get(m_Words.data(), LastElementIndex() - static_cast<typename Words::Index>(i));
+		++Output;
+	}
+
+	m_Size -= NumberOfElements;
+	m_Words.resize(Words::WordsFor(m_Size));
+
+	return Output;
+}
+
+template<typename T, unsigned Bits>
+template<typename Compare>
+void PackedSListArray<T, Bits>::merge(PackedSListArray<value_type, Bits>&& That, Compare Comp)
+{
+	merge(std::span<PackedSListArray<value_type, Bits>>(&That, 1), Comp);
+}
+
+// The elements don't have an address of their own, so each list is unpacked first, in list order, wrapped in a Slot: unlike std::vector<bool>,
+// a std::vector of Slots stores every value at an address of its own, as the LoserTree needs. The merged values are packed into a new list,
+// which replaces this one only once the merge is done, so if Comp throws none of the lists is modified.
+template<typename T, unsigned Bits>
+template<typename Compare>
+void PackedSListArray<T, Bits>::merge(std::span<PackedSListArray<value_type, Bits>> Others, Compare Comp, [[maybe_unused]] unsigned int Threads)
+{
+	MergeLists(Others, Comp);
+}
+
+template<typename T, unsigned Bits>
+template<typename ListType, typename Compare>
+void PackedSListArray<T, Bits>::MergeLists(std::span<ListType> Others, Compare Comp)
+{
+	struct Slot
+	{
+		value_type Value;
+	};
+
+	auto CompareSlots = [Comp](const Slot& A, const Slot& B) { return Comp(A.Value, B.Value); };
+
+	std::vector<std::vector<Slot>> Runs;
+	Runs.reserve(Others.size() + 1);
+
+	auto Unpack = [&Runs](const PackedSListArray<value_type, Bits>& List)
+	{
+		std::vector<Slot>& Run = Runs.emplace_back();
+		Run.reserve(List.size());
+
+		for (auto It = List.cbegin(); It != List.cend(); ++It) Run.push_back(Slot{ *It });
+	};
+
+	Unpack(*this);
+	for (const ListType& Other : Others)
+	{
+		if (&Other != this) Unpack(Other);
+	}
+
+	LoserTree<Slot, decltype(CompareSlots)> Tree(Runs.size(), CompareSlots);
+	std::vector<size_type> Next(Runs.size(), 0);
+
+	size_type NumberOfElements = 0;
+	for (size_type i = 0; i < Runs.size(); ++i)
+	{
+		Tree.Set(i, Runs[i].empty() ? nullptr : Runs[i].data());
+		NumberOfElements += Runs[i].size();
+	}
+
+	Tree.Build();
+
+	std::vector<value_type> Merged;
+	Merged.reserve(NumberOfElements);
+
+	while (!Tree.Exhausted())
+	{
+		const size_type Winner = Tree.Winner();
+		Merged.push_back(Runs[Winner][Next[Winner]++].Value);
+
+		Tree.Replace(Next[Winner] < Runs[Winner].size() ? &Runs[Winner][Next[Winner]] : nullptr);
+	}
+
+	PackedSListArray<value_type, Bits> Result(Merged.cbegin(), Merged.cend());
+	swap(Result);
+
+	for (ListType& Other : Others)
+	{
+		if (&Other != this) Other.clear();
+	}
+}
+
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::clear()
+{
+	m_Words.clear();
+	m_Size = 0;
+}
+
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::swap(PackedSListArray<value_type, Bits>& That) noexcept
+{
+	std::swap(m_Words, That.m_Words);
+	std::swap(m_Size, That.m_Size);
+}
+
+
+
+
+// Each field is ORed into the word being filled, which is stored once per word, instead of masking and writing it back for every element.
+// The word is only extended right before its first field is set, so the list stays consistent if an element can't be read.
+template<typename T, unsigned Bits>
+template<std::input_iterator InputIt>
+void PackedSListArray<T, Bits>::AppendPacked(InputIt First, InputIt Last)
+{
+	unsigned Shift = static_cast<unsigned>(m_Size % Words::FieldsPerWord * Bits);
+
+	// The fields past the end of the list may still hold popped values.
+	if (Shift != 0) m_Words.back() &= (typename Words::Word(1) << Shift) - 1;
+
+	for (; First != Last; ++First)
+	{
+		const typename Words::Word Code = Words::Encode(*First);
+
+		if (Shift == 0) m_Words.push_back(Code);
+		else m_Words.back() |= Code << Shift;
+
+		++m_Size;
+		Shift = (Shift + Bits) % 64;
+	}
+}
+
+// Grows geometrically, just like push_back(): reserving the exact size for each burst would reallocate the vector at every burst.
+template<typename T, unsigned Bits>
+void PackedSListArray<T, Bits>::Reserve(size_type NumberOfElements)
+{
+	const size_type NumberOfWords = Words::WordsFor(NumberOfElements);
+	if (NumberOfWords > m_Words.capacity()) m_Words.reserve(std::max(NumberOfWords, 2 * m_Words.capacity()));
+}
+
+
+
+
+namespace std
+{
+	template<typename T, unsigned Bits>
+	void swap(PackedSListArray<T, Bits>& A, PackedSListArray<T, Bits>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
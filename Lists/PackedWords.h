@@ -0,0 +1,126 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * Word-level operations shared by the packed lists and their iterators, which store each element in Bits bits of an array of 64 bit words.
+ *
+ * Bits must divide 64, so an element never straddles two words. Element i is stored in word i / FieldsPerWord, starting at bit (i % FieldsPerWord) * Bits.
+ * Values are converted to unsigned codes with static_cast, keeping their lowest Bits bits, so T can be bool, an enum or a small unsigned integer.
+ *
+ * Count() and FindLast() compare a whole word against the searched code at once, instead of extracting its elements one by one.
+ *
+ * @see PackedSListArray, PackedFixedSList, PackedSIterator
+ */
+template<typename T, unsigned Bits>
+struct PackedWords final
+{
+	static_assert(Bits == 1 || Bits == 2 || Bits == 4 || Bits == 8, "Packed elements can only be 1, 2, 4 or 8 bits wide.");
+
+	using Word = std::uint64_t;
+	using Index = long long int;
+
+	static constexpr std::size_t FieldsPerWord = 64 / Bits;
+	static constexpr Word FieldMask = (Word(1) << Bits) - 1;
+	// The lowest bit of every field.
+	static constexpr Word LowBits = ~Word(0) / FieldMask;
+
+
+	static constexpr std::size_t WordsFor(std::size_t NumberOfElements) { return (NumberOfElements + FieldsPerWord - 1) / FieldsPerWord; }
+
+	static constexpr Word Encode(const T& Value) { return static_cast<Word>(Value) & FieldMask; }
+	static constexpr T Decode(Word Code) { return static_cast<T>(Code); }
+
+	// The same code repeated in every field of a word.
+	static constexpr Word Broadcast(const T& Value) { return Encode(Value) * LowBits; }
+
+
+	static constexpr T Get(const Word* Words, Index Position)
+	{
+		return Decode((Words[Position / FieldsPerWord] >> (Position % FieldsPerWord * Bits)) & FieldMask);
+	}
+
+	static constexpr void Set(Word* Words, Index Position, const T& Value)
+	{
+		const unsigned Shift = Position % FieldsPerWord * Bits;
+		Word& Target = Words[Position / FieldsPerWord];
+
+		Target = (Target & ~(FieldMask << Shift)) | (Encode(Value) << Shift);
+	}
+
+	static constexpr void Fill(Word* Words, std::size_t NumberOfElements, const T& Value)
+	{
+		const Word Pattern = Broadcast(Value);
+		for (std::size_t i = 0; i < WordsFor(NumberOfElements); ++i) Words[i] = Pattern;
+	}
+
+	static constexpr void Reverse(Word* Words, std::size_t NumberOfElements) { Reverse(Words, 0, NumberOfElements); }
+
+	// Reverses the elements from position First up to, but excluding, Last.
+	static constexpr void Reverse(Word* Words, std::size_t First, std::size_t Last)
+	{
+		for (Index Low = static_cast<Index>(First), High = static_cast<Index>(Last) - 1; Low < High; ++Low, --High)
+		{
+			const T LowValue = Get(Words, Low);
+			Set(Words, Low, Get(Words, High));
+			Set(Words, High, LowValue);
+		}
+	}
+
+
+	static constexpr std::size_t Count(const Word* Words, std::size_t NumberOfElements, const T& Value)
+	{
+		const Word Pattern = Broadcast(Value);
+		const std::size_t FullWords = NumberOfElements / FieldsPerWord;
+
+		std::size_t Matches = 0;
+
+		for (std::size_t i = 0; i < FullWords; ++i)
+		{
+			Matches += std::popcount(MatchingFields(Words[i] ^ Pattern));
+		}
+
+		if (NumberOfElements % FieldsPerWord != 0)
+		{
+			Matches += std::popcount(MatchingFields(Words[FullWords] ^ Pattern) & UsedBits(NumberOfElements % FieldsPerWord));
+		}
+
+		return Matches;
+	}
+
+	// Returns the highest position, which is the closest to the front of the lists, holding Value, or -1 if there's none.
+	static constexpr Index FindLast(const Word* Words, std::size_t NumberOfElements, const T& Value)
+	{
+		const Word Pattern = Broadcast(Value);
+
+		for (Index i = static_cast<Index>(WordsFor(NumberOfElements)) - 1; i >= 0; --i)
+		{
+			Word Matches = MatchingFields(Words[i] ^ Pattern);
+
+			const std::size_t FieldsInWord = NumberOfElements - i * FieldsPerWord;
+			if (FieldsInWord < FieldsPerWord) Matches &= UsedBits(FieldsInWord);
+
+			if (Matches != 0) return i * static_cast<Index>(FieldsPerWord) + (63 - std::countl_zero(Matches)) / Bits;
+		}
+
+		return -1;
+	}
+
+private:
+
+	// Sets the lowest bit of every field of Difference which is zero.
+	static constexpr Word MatchingFields(Word Difference)
+	{
+		// ORs every bit of each field into its lowest one: what's shifted in from the next field only reaches bits above it.
+		for (unsigned Shift = 1; Shift < Bits; Shift *= 2) Difference |= Difference >> Shift;
+
+		return ~Difference & LowBits;
+	}
+
+	static constexpr Word UsedBits(std::size_t NumberOfFields) { return (Word(1) << (NumberOfFields * Bits)) - 1; }
+};
@@ -0,0 +1,195 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include "SharedSNode.h"
+#include "SIterator.h"
+
+
+/**
+ * Immutable Forward List, compatible with stl and its non modifying algorithms.
+ *
+ * Uses a struct called SharedSNode to store its values and link them together.
+ * Since nodes are never modified after their creation, lists share their tails instead of copying them:
+ * copies are O(1), and push_front() and pop_front() are O(1) too, but return a new version of the list, leaving the original untouched.
+ * As a consequence, the cost of taking a snapshot of a list does not depend on its length.
+ *
+ * Nodes are reference counted with atomic counters, so different lists sharing the same nodes can be used from different threads.
+ * A single PersistentSList object, just like a std::shared_ptr, must not be reassigned while other threads read it.
+ *
+ * Uses ConstSIterator as both iterator and const_iterator, since the values cannot be modified.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SharedSNode, ConstSIterator, SList
+ */
+template<typename T>
+class PersistentSList final
+{
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = const T&;
+	using const_reference  = const T&;
+	using pointer          = const T*;
+	using const_pointer    = const T*;
+	using iterator         = ConstSIterator<value_type, SharedSNode<value_type>>;
+	using const_iterator   = ConstSIterator<value_type, SharedSNode<value_type>>;
+
+
+	PersistentSList() = default;
+	PersistentSList(size_type NumberOfElements);
+	PersistentSList(size_type NumberOfElements, const value_type& BaseValue);
+	PersistentSList(std::initializer_list<value_type> IL);
+	PersistentSList(const PersistentSList<value_type>& That) noexcept;
+	PersistentSList(PersistentSList<value_type>&& That) noexcept;
+	~PersistentSList();
+
+
+	PersistentSList<value_type>& operator= (PersistentSList<value_type> That) noexcept; // copy-and-swap idiom.
+
+
+	inline const_iterator begin() const noexcept { return const_iterator(m_FirstNode); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(m_FirstNode); }
+
+	inline const_iterator end() const noexcept { return const_iterator(); }
+	inline const_iterator cend() const noexcept { return const_iterator(); }
+
+	// Both return a new version of the list, sharing all of its nodes with this one except the new front.
+	[[nodiscard]] PersistentSList<value_type> push_front(const value_type& Value) const;
+	[[nodiscard]] PersistentSList<value_type> pop_front() const noexcept;
+
+	void clear() noexcept;
+	void swap(PersistentSList<value_type>& That) noexcept;
+
+	inline const_reference front() const { return m_FirstNode->Data; }
+
+	inline bool empty() const { return m_FirstNode == nullptr; }
+
+private:
+
+	// Takes ownership of a reference to FirstNode.
+	explicit inline PersistentSList(SharedSNode<value_type>* FirstNode) noexcept : m_FirstNode(FirstNode) { }
+
+	void PushFrontInPlace(const value_type& Value);
+
+	SharedSNode<value_type>* m_FirstNode = nullptr;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+PersistentSList<T>::PersistentSList(size_type NumberOfElements) : PersistentSList<value_type>(NumberOfElements, value_type()) { }
+
+template<typename T>
+PersistentSList<T>::PersistentSList(size_type NumberOfElements, const value_type& BaseValue)
+{
+	while (NumberOfElements > 0)
+	{
+		PushFrontInPlace(BaseValue);
+		--NumberOfElements;
+	}
+}
+
+template<typename T>
+PersistentSList<T>::PersistentSList(std::initializer_list<value_type> IL)
+{
+	for (const value_type& Value : IL)
+	{
+		PushFrontInPlace(Value);
+	}
+}
+
+template<typename T>
+PersistentSList<T>::PersistentSList(const PersistentSList<value_type>& That) noexcept : m_FirstNode(That.m_FirstNode)
+{
+	SharedSNode<value_type>::AddReference(m_FirstNode);
+}
+
+template<typename T>
+PersistentSList<T>::PersistentSList(PersistentSList<value_type>&& That) noexcept : m_FirstNode(That.m_FirstNode)
+{
+	That.m_FirstNode = nullptr;
+}
+
+template<typename T>
+PersistentSList<T>::~PersistentSList() { clear(); }
+
+
+
+template<typename T>
+auto PersistentSList<T>::operator= (PersistentSList<value_type> That) noexcept -> PersistentSList<value_type>&
+{
+	swap(That);
+	return *this;
+}
+
+
+
+
+template<typename T>
+auto PersistentSList<T>::push_front(const value_type& Value) const -> PersistentSList<value_type>
+{
+	SharedSNode<value_type>::AddReference(m_FirstNode);
+
+	try
+	{
+		return PersistentSList<value_type>(new SharedSNode<value_type>(m_FirstNode, Value));
+	}
+	catch (...)
+	{
+		SharedSNode<value_type>::RemoveReference(m_FirstNode);
+		throw;
+	}
+}
+
+template<typename T>
+auto PersistentSList<T>::pop_front() const noexcept -> PersistentSList<value_type>
+{
+	if (m_FirstNode == nullptr) return PersistentSList<value_type>();
+
+	SharedSNode<value_type>::AddReference(m_FirstNode->Next);
+	return PersistentSList<value_type>(m_FirstNode->Next);
+}
+
+template<typename T>
+void PersistentSList<T>::clear() noexcept
+{
+	SharedSNode<value_type>::RemoveReference(m_FirstNode);
+	m_FirstNode = nullptr;
+}
+
+template<typename T>
+void PersistentSList<T>::swap(PersistentSList<value_type>& That) noexcept
+{
+	std::swap(m_FirstNode, That.m_FirstNode);
+}
+
+
+
+// Used only while constructing, when no other list can see this one's nodes yet.
+template<typename T>
+void PersistentSList<T>::PushFrontInPlace(const value_type& Value)
+{
+	m_FirstNode = new SharedSNode<value_type>(m_FirstNode, Value);
+}
+
+
+
+
+namespace std
+{
+	template<typename T>
+	void swap(PersistentSList<T>& A, PersistentSList<T>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
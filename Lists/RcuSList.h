@@ -0,0 +1,341 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "RcuSNode.h"
+#include "SIterator.h"
+
+
+/**
+ * Forward List, read by many threads while a single thread modifies it, following the Read-Copy-Update pattern.
+ *
+ * Uses a struct called RcuSNode to store its values and link them together, iterated through ConstSIterator.
+ * Readers don't take any lock and don't perform any atomic read-modify-write: each reader thread registers once through make_reader(),
+ * then wraps every traversal in a ReadLock, which only stores the current epoch in the reader's own cache line.
+ *
+ * The writer publishes push_front(), insert_after(), erase_after() and the replace_* operations with release stores, so readers see either
+ * the old or the new version of the list, never a partial one. Values are never modified in place: they are replaced by new nodes.
+ * Unlinked nodes are retired, and freed only after a grace period, once every reader that could still see them has left its ReadLock.
+ * The writer waits for the grace period in batches, every RetiredNodesBatch retired nodes, or explicitly through synchronize().
+ *
+ * Only one thread at a time may call the modifying methods, and it must not hold a ReadLock while doing so.
+ * ReadLocks can't be nested, and iterators must not be used after their ReadLock is released.
+ * Readers must be destroyed before the list.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see RcuSNode, ConstSIterator, SList
+ */
+template<typename T>
+class RcuSList final
+{
+	struct alignas(64) ReaderSlot
+	{
+		std::atomic<std::uint64_t> Epoch = 0; // 0 when the reader is outside a ReadLock.
+		std::atomic<bool> InUse = false;
+	};
+
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = const T&;
+	using const_reference  = const T&;
+	using pointer          = const T*;
+	using const_pointer    = const T*;
+	using iterator         = ConstSIterator<value_type, RcuSNode<value_type>>;
+	using const_iterator   = ConstSIterator<value_type, RcuSNode<value_type>>;
+
+	static constexpr size_type MaxReaders = 128;
+	static constexpr size_type RetiredNodesBatch = 128;
+
+
+	/**
+	 * Read-side critical section: the nodes reachable while it's alive won't be freed until it's destroyed.
+	 */
+	class ReadLock final
+	{
+	public:
+
+		inline explicit ReadLock(ReaderSlot& Slot, const std::atomic<std::uint64_t>& GlobalEpoch) noexcept : m_Slot(Slot)
+		{
+			// Acquire, pairing with the epoch increment of synchronize(): a reader seeing the new epoch also sees the unlinks made before it,
+			// so it can't reach the nodes retired by that synchronize(), even though it won't be waited for.
+			m_Slot.Epoch.store(GlobalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+			// Orders the epoch store before the loads of the nodes, pairing with the fence after the increment in synchronize():
+			// either the writer sees this reader's old epoch and waits for it, or this reader sees the unlinks and can't reach the retired nodes.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+		}
+
+		inline ~ReadLock() { m_Slot.Epoch.store(0, std::memory_order_release); }
+
+		ReadLock(const ReadLock&) = delete;
+		ReadLock& operator= (const ReadLock&) = delete;
+
+	private:
+
+		ReaderSlot& m_Slot;
+	};
+
+
+	/**
+	 * A registered reader thread, owning one of the MaxReaders slots of the list until its destruction.
+	 */
+	class Reader final
+	{
+	public:
+
+		inline Reader(Reader&& That) noexcept : m_List(That.m_List), m_Slot(That.m_Slot) { That.m_Slot = nullptr; }
+		inline ~Reader() { if (m_Slot != nullptr) m_Slot->InUse.store(false, std::memory_order_release); }
+
+		Reader(const Reader&) = delete;
+		Reader& operator= (const Reader&) = delete;
+
+		[[nodiscard]] inline ReadLock lock() const noexcept { return ReadLock(*m_Slot, m_List->m_GlobalEpoch); }
+
+	private:
+
+		friend class RcuSList<T>;
+
+		inline Reader(const RcuSList<T>* List, ReaderSlot* Slot) noexcept : m_List(List), m_Slot(Slot) { }
+
+		const RcuSList<T>* m_List;
+		ReaderSlot* m_Slot;
+	};
+
+
+	RcuSList() = default;
+	RcuSList(size_type NumberOfElements);
+	RcuSList(size_type NumberOfElements, const value_type& BaseValue);
+	RcuSList(std::initializer_list<value_type> IL);
+	// Readers hold pointers to the list, so it can't be copied or moved.
+	RcuSList(const RcuSList<value_type>&) = delete;
+	RcuSList<value_type>& operator= (const RcuSList<value_type>&) = delete;
+	~RcuSList();
+
+
+	// Claims a reader slot: throws std::length_error if all MaxReaders slots are taken.
+	[[nodiscard]] Reader make_reader() const;
+
+
+	// Readers must call these only while holding a ReadLock.
+
+	inline const_iterator begin() const noexcept { return const_iterator(m_FirstNode.load(std::memory_order_acquire)); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(m_FirstNode.load(std::memory_order_acquire)); }
+
+	inline const_iterator end() const noexcept { return const_iterator(); }
+	inline const_iterator cend() const noexcept { return const_iterator(); }
+
+	inline const_reference front() const { return m_FirstNode.load(std::memory_order_acquire)->Data; }
+
+	inline bool empty() const { return m_FirstNode.load(std::memory_order_acquire) == nullptr; }
+
+
+	// Writer only.
+
+	void push_front(const value_type& Value);
+	void pop_front();
+	void insert_after(const_iterator Position, const value_type& Value);
+	void erase_after(const_iterator Position);
+	void replace_front(const value_type& Value);
+	void replace_after(const_iterator Position, const value_type& Value);
+	void clear();
+
+	// Waits until every reader has left the ReadLock it was holding, then frees all the retired nodes.
+	void synchronize();
+
+private:
+
+	void Retire(RcuSNode<value_type>* Node);
+
+	std::atomic<RcuSNode<value_type>*> m_FirstNode = nullptr;
+	std::atomic<std::uint64_t> m_GlobalEpoch = 1;
+
+	mutable ReaderSlot m_Readers[MaxReaders];
+	std::vector<RcuSNode<value_type>*> m_RetiredNodes;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+RcuSList<T>::RcuSList(size_type NumberOfElements) : RcuSList<value_type>(NumberOfElements, value_type()) { }
+
+template<typename T>
+RcuSList<T>::RcuSList(size_type NumberOfElements, const value_type& BaseValue)
+{
+	while (NumberOfElements > 0)
+	{
+		push_front(BaseValue);
+		--NumberOfElements;
+	}
+}
+
+template<typename T>
+RcuSList<T>::RcuSList(std::initializer_list<value_type> IL)
+{
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+// No reader can be alive anymore, so everything can be freed right away.
+template<typename T>
+RcuSList<T>::~RcuSList()
+{
+	RcuSNode<value_type>* CurrentNode = m_FirstNode.load(std::memory_order_relaxed);
+
+	while (CurrentNode != nullptr)
+	{
+		RcuSNode<value_type>* NextNode = CurrentNode->Next.load(std::memory_order_relaxed);
+		delete CurrentNode;
+		CurrentNode = NextNode;
+	}
+
+	for (RcuSNode<value_type>* Node : m_RetiredNodes) delete Node;
+}
+
+
+
+template<typename T>
+auto RcuSList<T>::make_reader() const -> Reader
+{
+	for (ReaderSlot& Slot : m_Readers)
+	{
+		bool Expected = false;
+
+		if (!Slot.InUse.load(std::memory_order_relaxed) && Slot.InUse.compare_exchange_strong(Expected, true, std::memory_order_acq_rel))
+		{
+			return Reader(this, &Slot);
+		}
+	}
+
+	throw std::length_error("RcuSList can't register more than MaxReaders readers.");
+}
+
+
+
+
+template<typename T>
+void RcuSList<T>::push_front(const value_type& Value)
+{
+	RcuSNode<value_type>* NewNode = new RcuSNode<value_type>(m_FirstNode.load(std::memory_order_relaxed), Value);
+	m_FirstNode.store(NewNode, std::memory_order_release);
+}
+
+template<typename T>
+void RcuSList<T>::pop_front()
+{
+	RcuSNode<value_type>* OldFirstNode = m_FirstNode.load(std::memory_order_relaxed);
+	if (OldFirstNode == nullptr) return;
+
+	m_FirstNode.store(OldFirstNode->Next.load(std::memory_order_relaxed), std::memory_order_release);
+	Retire(OldFirstNode);
+}
+
+template<typename T>
+void RcuSList<T>::insert_after(const_iterator Position, const value_type& Value)
+{
+	RcuSNode<value_type>* PreviousNode = Position.node();
+
+	RcuSNode<value_type>* NewNode = new RcuSNode<value_type>(PreviousNode->Next.load(std::memory_order_relaxed), Value);
+	PreviousNode->Next.store(NewNode, std::memory_order_release);
+}
+
+template<typename T>
+void RcuSList<T>::erase_after(const_iterator Position)
+{
+	RcuSNode<value_type>* PreviousNode = Position.node();
+	RcuSNode<value_type>* ErasedNode = PreviousNode->Next.load(std::memory_order_relaxed);
+	if (ErasedNode == nullptr) return;
+
+	PreviousNode->Next.store(ErasedNode->Next.load(std::memory_order_relaxed), std::memory_order_release);
+	Retire(ErasedNode);
+}
+
+template<typename T>
+void RcuSList<T>::replace_front(const value_type& Value)
+{
+	RcuSNode<value_type>* OldFirstNode = m_FirstNode.load(std::memory_order_relaxed);
+	if (OldFirstNode == nullptr) return;
+
+	RcuSNode<value_type>* NewNode = new RcuSNode<value_type>(OldFirstNode->Next.load(std::memory_order_relaxed), Value);
+	m_FirstNode.store(NewNode, std::memory_order_release);
+	Retire(OldFirstNode);
+}
+
+template<typename T>
+void RcuSList<T>::replace_after(const_iterator Position, const value_type& Value)
+{
+	RcuSNode<value_type>* PreviousNode = Position.node();
+	RcuSNode<value_type>* ReplacedNode = PreviousNode->Next.load(std::memory_order_relaxed);
+	if (ReplacedNode == nullptr) return;
+
+	RcuSNode<value_type>* NewNode = new RcuSNode<value_type>(ReplacedNode->Next.load(std::memory_order_relaxed), Value);
+	PreviousNode->Next.store(NewNode, std::memory_order_release);
+	Retire(ReplacedNode);
+}
+
+// Unlinks the whole chain at once: readers see either all of it or none of it.
+template<typename T>
+void RcuSList<T>::clear()
+{
+	RcuSNode<value_type>* CurrentNode = m_FirstNode.load(std::memory_order_relaxed);
+	m_FirstNode.store(nullptr, std::memory_order_release);
+
+	while (CurrentNode != nullptr)
+	{
+		RcuSNode<value_type>* NextNode = CurrentNode->Next.load(std::memory_order_relaxed);
+		Retire(CurrentNode);
+		CurrentNode = NextNode;
+	}
+}
+
+
+
+template<typename T>
+void RcuSList<T>::synchronize()
+{
+	if (m_RetiredNodes.empty()) return;
+
+	// Readers entering from now on may see the new epoch or the old one, but they can't reach the retired nodes anymore.
+	// The increment is a seq_cst read-modify-write, so the unlinks stored before it are visible to every reader loading the new epoch,
+	// through the acquire load of ReadLock. The fence after it pairs with ReadLock's one, ordering it before the loads of the reader slots.
+	const std::uint64_t NewEpoch = m_GlobalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	for (ReaderSlot& Slot : m_Readers)
+	{
+		if (!Slot.InUse.load(std::memory_order_acquire)) continue;
+
+		for (;;)
+		{
+			const std::uint64_t ReaderEpoch = Slot.Epoch.load(std::memory_order_acquire);
+			if (ReaderEpoch == 0 || ReaderEpoch >= NewEpoch) break;
+
+			std::this_thread::yield();
+		}
+	}
+
+	for (RcuSNode<value_type>* Node : m_RetiredNodes) delete Node;
+	m_RetiredNodes.clear();
+}
+
+template<typename T>
+void RcuSList<T>::Retire(RcuSNode<value_type>* Node)
+{
+	m_RetiredNodes.push_back(Node);
+
+	if (m_RetiredNodes.size() >= RetiredNodesBatch) synchronize();
+}
@@ -0,0 +1,28 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <atomic>
+
+
+/**
+ * Simple support struct used by RcuSList, to implement a Forward List read concurrently to its modifications.
+ * Just like SNode, it wraps a templated datatype and a pointer to the next node, but the pointer is atomic:
+ * the writer publishes its changes with release stores, and the readers see them through plain atomic loads, without any read-modify-write.
+ *
+ * Data is never modified after construction: a value is replaced by linking a new node in place of the old one.
+ *
+ * @see RcuSList, SNode
+ */
+template<typename T>
+struct RcuSNode final
+{
+	std::atomic<RcuSNode<T>*> Next = nullptr;
+	const T Data;
+
+	RcuSNode() = delete;
+	RcuSNode(const RcuSNode<T>&) = delete;
+	RcuSNode<T>& operator= (const RcuSNode<T>&) = delete;
+
+	inline RcuSNode(RcuSNode<T>* _Next, const T& _Data) : Next(_Next), Data(_Data) { }
+};
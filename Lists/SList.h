@@ -2,9 +2,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
 #include "SNode.h"
+#include "SListCore.h"
 #include "SIterator.h"
+#include "LoserTree.h"
+#include "SListReclaimer.h"
 
 
 /**
@@ -15,10 +27,24 @@
  * 
  * Allocates memory on the free store, but manages it internally.
  * This means that although push and pop operations are O(1), they will request memory to the OS each time.
+ *
+ * It also keeps track of its last node, so that push_back() and append() are O(1) too, allowing its use as a FIFO queue.
+ * Sorted lists are merged by relinking their nodes, any number of them at once, through a LoserTree.
+ * Bursts of elements are pushed in batches: push_front_range() links the new nodes to each other, then to the list all at once.
+ * pop_front_n() can detach a burst as a list of its own, without copying or freeing its nodes.
+ * Construction and assignment from a range preserve the range's order, unlike the initializer list ones.
+ * The number of elements is cached and kept updated by every operation, so size() is O(1).
+ *
+ * Clearing or destroying a list frees each of its nodes, so it takes O(n) on the calling thread.
+ * In deferred destruction mode, long chains are instead detached in O(1) and destroyed by the SListReclaimer's background thread.
+ * Copies and moved-to lists take the mode of their source, while swap() and assignment leave each list its own.
+ *
+ * The chain of nodes is linked, unlinked, reversed and spliced by SListCore, which isn't a template:
+ * every instantiation shares its code, and SList only allocates, constructs and destroys the typed nodes.
  * 
  * Note: just like std containers, it won't delete user allocated's memory!
  * 
- * @see SNode, SIterator
+ * @see SNode, SIterator, SListCore, SListReclaimer
  */
 template<typename T>
 class SList final
@@ -39,6 +65,7 @@ public:
 	SList(size_type NumberOfElements);
 	SList(size_type NumberOfElements, const value_type& BaseValue);
 	SList(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> SList(InputIt First, InputIt Last);
 	SList(const SList<value_type>& That);
 	SList(SList<value_type>&& That);
 	~SList();
@@ -48,27 +75,61 @@ public:
 	SList<value_type>& operator= (std::initializer_list<value_type> IL);
 
 
-	inline iterator begin() noexcept { return iterator(m_FirstNode); }
-	inline const_iterator cbegin() const noexcept { return const_iterator(m_FirstNode); }
+	inline iterator begin() noexcept { return iterator(FirstNode()); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(FirstNode()); }
 
 	inline iterator end() noexcept { return iterator(); }
 	inline const_iterator cend() const noexcept { return const_iterator(); }
 
 	void assign(size_type NumberOfElements, const value_type& BaseValue);
 	void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> void assign(InputIt First, InputIt Last);
 	void push_front(const value_type& Value);
+	void push_back(const value_type& Value);
 	void pop_front();
+	// Both keep the order of the range: First becomes the front.
+	template<std::input_iterator InputIt> void push_front_range(InputIt First, InputIt Last);
+	void push_front_n(size_type NumberOfElements, const value_type& Value);
+	// Moves at most NumberOfElements values to Output, in list order, and returns the iterator past the last one written.
+	template<std::output_iterator<T> OutputIt> OutputIt pop_front_n(size_type NumberOfElements, OutputIt Output);
+	// Detaches at most NumberOfElements nodes as a new list, without copying or freeing them: O(1) when taking all of them.
+	SList<value_type> pop_front_n(size_type NumberOfElements) noexcept;
+	void insert_after(const_iterator Position, const value_type& Value);
+	void erase_after(const_iterator Position);
+	void append(SList<value_type>&& That) noexcept;
+	void splice_after(const_iterator Position, SList<value_type>&& That) noexcept;
+	// Both merge sorted lists into this sorted one, leaving them empty. Equal values keep the order of their lists, this one's first.
+	template<typename Compare = std::less<T>> void merge(SList<value_type>&& That, Compare Comp = Compare());
+	template<typename Compare = std::less<T>> void merge(std::span<SList<value_type>> Others, Compare Comp = Compare());
+	void reverse() noexcept;
 	void clear();
 	void swap(SList<value_type>& That) noexcept;
 
-	inline reference front() { return m_FirstNode->Data; }
-	inline const_reference front() const { return m_FirstNode->Data; }
+	inline reference front() { return FirstNode()->Data; }
+	inline const_reference front() const { return FirstNode()->Data; }
 
-	inline bool empty() const { return m_FirstNode == nullptr; }
+	inline reference back() { return LastNode()->Data; }
+	inline const_reference back() const { return LastNode()->Data; }
+
+	// Once set, clear() and the destructor hand chains of at least SListReclaimer::MinimumDeferredSize nodes to the SListReclaimer.
+	// If its queue is full, or it's been shut down at exit, they're destroyed synchronously anyway. SListReclaimer::Instance().Flush() waits for the queued ones.
+	void set_deferred_destruction(bool Deferred);
+	inline bool deferred_destruction() const noexcept { return m_DeferredDestruction; }
+
+	inline bool empty() const { return m_Core.First() == nullptr; }
+	inline size_type size() const noexcept { return m_Core.Size(); }
+	// Just like std::forward_list, the limit is given by the addressable memory, rather than by the list itself.
+	inline size_type max_size() const noexcept { return static_cast<size_type>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(SNode<value_type>); }
 
 private:
 
-	SNode<value_type>* m_FirstNode = nullptr;
+	inline SNode<value_type>* FirstNode() const noexcept { return static_cast<SNode<value_type>*>(m_Core.First()); }
+	inline SNode<value_type>* LastNode() const noexcept { return static_cast<SNode<value_type>*>(m_Core.Last()); }
+
+	static void DestroyChain(SListLink* First) noexcept;
+
+	SListCore m_Core;
+	bool m_DeferredDestruction = false;
 };
 
 
@@ -87,27 +148,20 @@ template<typename T>
 SList<T>::SList(std::initializer_list<value_type> IL) { assign(IL); }
 
 template<typename T>
-SList<T>::SList(const SList<value_type>& That)
-{
-	SNode<value_type>* That_CurrentNode = That.m_FirstNode;
-	SNode<value_type>* This_PreviousNode = nullptr;
-
-	SNode<value_type>* NewNode = nullptr;
+template<std::input_iterator InputIt>
+SList<T>::SList(InputIt First, InputIt Last) { assign(First, Last); }
 
-	while (That_CurrentNode != nullptr)
+template<typename T>
+SList<T>::SList(const SList<value_type>& That) : m_DeferredDestruction(That.m_DeferredDestruction)
+{
+	for (SNode<value_type>* That_CurrentNode = That.FirstNode(); That_CurrentNode != nullptr; That_CurrentNode = That_CurrentNode->NextNode())
 	{
-		NewNode = new SNode<value_type>(*That_CurrentNode);
-
-		if (this->empty()) m_FirstNode = NewNode;
-		else This_PreviousNode->Next = NewNode; // Compiler warning, but it never gets dereferenced when null.
-
-		This_PreviousNode = NewNode;
-		That_CurrentNode = That_CurrentNode->Next;
+		m_Core.PushBack(new SNode<value_type>(nullptr, That_CurrentNode->Data));
 	}
 }
 
 template<typename T>
-SList<T>::SList(SList<value_type>&& That) : m_FirstNode(std::move(That.m_FirstNode)) { }
+SList<T>::SList(SList<value_type>&& That) : m_Core(std::move(That.m_Core)), m_DeferredDestruction(That.m_DeferredDestruction) { }
 
 template<typename T>
 SList<T>::~SList() { clear(); }
@@ -117,8 +171,9 @@ SList<T>::~SList() { clear(); }
 template<typename T>
 auto SList<T>::operator= (SList<value_type> That) -> SList<value_type>&
 {
-	clear();
-	std::swap(m_FirstNode, That.m_FirstNode);
+	// The old nodes, now in That, are destroyed the way this list's would be.
+	swap(That);
+	That.m_DeferredDestruction = m_DeferredDestruction;
 	return *this;
 }
 
@@ -156,34 +211,227 @@ void SList<T>::assign(std::initializer_list<value_type> IL)
 }
 
 
+// Builds the chain in a single pass, linking each new node after the last one.
+template<typename T>
+template<std::input_iterator InputIt>
+void SList<T>::assign(InputIt First, InputIt Last)
+{
+	clear();
+
+	for (; First != Last; ++First)
+	{
+		push_back(*First);
+	}
+}
+
+
 template<typename T>
 void SList<T>::push_front(const value_type& Value)
 {
-	SNode<value_type>* NewNode = new SNode<value_type>(m_FirstNode, Value);
-	m_FirstNode = NewNode;
+	m_Core.PushFront(new SNode<value_type>(nullptr, Value));
+}
+
+template<typename T>
+void SList<T>::push_back(const value_type& Value)
+{
+	m_Core.PushBack(new SNode<value_type>(nullptr, Value));
 }
 
 template<typename T>
 void SList<T>::pop_front()
 {
-	if (m_FirstNode != nullptr)
+	delete static_cast<SNode<value_type>*>(m_Core.PopFront());
+}
+
+// The new nodes are linked in a list of their own, then that list is linked in front of this one: if an allocation fails, only the new list is freed.
+template<typename T>
+template<std::input_iterator InputIt>
+void SList<T>::push_front_range(InputIt First, InputIt Last)
+{
+	SList<value_type> Chain;
+	Chain.assign(First, Last);
+
+	Chain.append(std::move(*this));
+	swap(Chain);
+}
+
+template<typename T>
+void SList<T>::push_front_n(size_type NumberOfElements, const value_type& Value)
+{
+	SList<value_type> Chain;
+	Chain.assign(NumberOfElements, Value);
+
+	Chain.append(std::move(*this));
+	swap(Chain);
+}
+
+// Each node is its own allocation, so it's freed right after its value is moved out, while still in cache: detaching the whole chain first would walk it twice.
+template<typename T>
+template<std::output_iterator<T> OutputIt>
+OutputIt SList<T>::pop_front_n(size_type NumberOfElements, OutputIt Output)
+{
+	for (; NumberOfElements > 0 && !empty(); --NumberOfElements)
 	{
-		SNode<value_type>* SecondNode = m_FirstNode->Next;
-		delete m_FirstNode;
-		m_FirstNode = SecondNode;
+		*Output = std::move(front());
+		++Output;
+
+		pop_front();
 	}
+
+	return Output;
+}
+
+template<typename T>
+auto SList<T>::pop_front_n(size_type NumberOfElements) noexcept -> SList<value_type>
+{
+	SList<value_type> Popped;
+	m_Core.SplitFront(NumberOfElements, Popped.m_Core);
+
+	return Popped;
+}
+
+template<typename T>
+void SList<T>::insert_after(const_iterator Position, const value_type& Value)
+{
+	m_Core.InsertAfter(Position.node(), new SNode<value_type>(nullptr, Value));
+}
+
+template<typename T>
+void SList<T>::erase_after(const_iterator Position)
+{
+	delete static_cast<SNode<value_type>*>(m_Core.EraseAfter(Position.node()));
+}
+
+// Moves all of That's nodes at the end of this list, relinking them without any copy or allocation.
+template<typename T>
+void SList<T>::append(SList<value_type>&& That) noexcept
+{
+	m_Core.Append(That.m_Core);
+}
+
+// Moves all of That's nodes right after Position, relinking them without any copy or allocation.
+template<typename T>
+void SList<T>::splice_after(const_iterator Position, SList<value_type>&& That) noexcept
+{
+	m_Core.SpliceAfter(Position.node(), That.m_Core);
+}
+
+template<typename T>
+template<typename Compare>
+void SList<T>::merge(SList<value_type>&& That, Compare Comp)
+{
+	merge(std::span<SList<value_type>>(&That, 1), Comp);
+}
+
+// Detaches every chain, then links the winner of the LoserTree at the back, one node at a time: no value is copied or moved.
+// A single pass merges all of them in O(n log k), instead of the O(n k) of merging them one by one.
+// Everything that may allocate is done before detaching the chains, and if Comp throws the nodes left are linked back after the merged ones:
+// either way, no node is lost.
+template<typename T>
+template<typename Compare>
+void SList<T>::merge(std::span<SList<value_type>> Others, Compare Comp)
+{
+	std::vector<SNode<value_type>*> Heads;
+	Heads.reserve(Others.size() + 1);
+
+	const std::size_t NumberOfSources = 1 + static_cast<std::size_t>(std::count_if(Others.begin(), Others.end(), [this](const SList<value_type>& Other) { return &Other != this; }));
+	LoserTree<value_type, Compare> Tree(NumberOfSources, Comp);
+
+	Heads.push_back(FirstNode());
+	m_Core.Release();
+
+	for (SList<value_type>& Other : Others)
+	{
+		if (&Other == this) continue;
+
+		Heads.push_back(Other.FirstNode());
+		Other.m_Core.Release();
+	}
+
+	try
+	{
+		for (std::size_t Source = 0; Source < Heads.size(); ++Source) Tree.Set(Source, Heads[Source] != nullptr ? &Heads[Source]->Data : nullptr);
+		Tree.Build();
+
+		while (!Tree.Exhausted())
+		{
+			SNode<value_type>*& Head = Heads[Tree.Winner()];
+			SNode<value_type>* Winner = Head;
+
+			Head = Winner->NextNode();
+			m_Core.PushBack(Winner);
+			Tree.Replace(Head != nullptr ? &Head->Data : nullptr);
+		}
+	}
+	catch (...)
+	{
+		for (SNode<value_type>* Head : Heads)
+		{
+			while (Head != nullptr)
+			{
+				SNode<value_type>* Next = Head->NextNode();
+				m_Core.PushBack(Head);
+				Head = Next;
+			}
+		}
+
+		throw;
+	}
+}
+
+template<typename T>
+void SList<T>::reverse() noexcept
+{
+	m_Core.Reverse();
 }
 
 template<typename T>
 void SList<T>::clear()
 {
-	while (m_FirstNode != nullptr) pop_front();
+	const bool Deferred = m_DeferredDestruction && size() >= SListReclaimer::MinimumDeferredSize;
+	SListLink* First = m_Core.Release();
+
+	if (!Deferred || !SListReclaimer::Instance().Submit(First, &DestroyChain))
+	{
+		DestroyChain(First);
+	}
+}
+
+// Starts the reclaimer right away, rather than on the first deferred clear().
+template<typename T>
+void SList<T>::set_deferred_destruction(bool Deferred)
+{
+	if (Deferred) SListReclaimer::Instance();
+	m_DeferredDestruction = Deferred;
 }
 
 template<typename T>
 void SList<T>::swap(SList<value_type>& That) noexcept
 {
-	std::swap(m_FirstNode, That.m_FirstNode);
+	m_Core.Swap(That.m_Core);
+}
+
+
+
+// Walks the chain once, freeing each node.
+// When the nodes don't need their destructor, the shared SListCore::DeallocateChain() frees them, given just their size.
+// SListLink is the only base of SNode, so both share the same address.
+template<typename T>
+void SList<T>::DestroyChain(SListLink* First) noexcept
+{
+	if constexpr (std::is_trivially_destructible_v<value_type> && alignof(SNode<value_type>) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	{
+		SListCore::DeallocateChain(First, sizeof(SNode<value_type>));
+	}
+	else
+	{
+		while (First != nullptr)
+		{
+			SListLink* Next = First->Next;
+			delete static_cast<SNode<value_type>*>(First);
+			First = Next;
+		}
+	}
 }
 
 
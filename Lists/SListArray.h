@@ -2,9 +2,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <thread>
 #include <vector>
 #include "SIteratorArray.h"
+#include "LoserTree.h"
+#include "PackedSListArray.h"
 
 
 /**
@@ -15,11 +24,16 @@
  * 
  * Uses a custom forward iterator class, called SIteratorArray, which makes use of the underlaying container's linearity.
  *
+ * Container can replace the std vector with any type exposing the same subset of its interface, like HugePageVector for very large lists.
+ *
+ * Sorted lists are merged through LoserTrees, any number of them at once: the output is split into partitions by splitters sampled from the lists,
+ * each one merged by its own thread.
+ *
  * Note: just like std containers, it won't delete user allocated's memory!
  *
- * @see SIteratorArray
+ * @see SIteratorArray, HugePageVector
  */
-template<typename T>
+template<typename T, typename Container = std::vector<T>>
 class SListArray final
 {
 public:
@@ -38,13 +52,14 @@ public:
 	SListArray(size_type NumberOfElements);
 	SListArray(size_type NumberOfElements, const value_type& BaseValue);
 	SListArray(std::initializer_list<value_type> IL);
-	SListArray(const SListArray<value_type>& That);
-	SListArray(SListArray<value_type>&& That);
+	template<std::input_iterator InputIt> SListArray(InputIt First, InputIt Last);
+	SListArray(const SListArray<value_type, Container>& That);
+	SListArray(SListArray<value_type, Container>&& That);
 	~SListArray();
 
 
-	SListArray<value_type>& operator= (SListArray<value_type> That); // copy-and-swap idiom.
-	SListArray<value_type>& operator= (std::initializer_list<value_type> IL);
+	SListArray<value_type, Container>& operator= (SListArray<value_type, Container> That); // copy-and-swap idiom.
+	SListArray<value_type, Container>& operator= (std::initializer_list<value_type> IL);
 
 
 	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
@@ -60,19 +75,50 @@ public:
 
 	void assign(size_type NumberOfElements, const value_type& BaseValue);
 	void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> void assign(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
 	void push_front(const value_type& Value);
 	void pop_front(); 
+	// Both keep the order of the range: First becomes the front. The vector grows at most once.
+	template<std::input_iterator InputIt> void push_front_range(InputIt First, InputIt Last);
+	void push_front_n(size_type NumberOfElements, const value_type& Value);
+	// Moves at most NumberOfElements values to Output, in list order, and returns the iterator past the last one written.
+	template<std::output_iterator<T> OutputIt> OutputIt pop_front_n(size_type NumberOfElements, OutputIt Output);
+	// Both merge sorted lists into this sorted one, leaving them empty. Equal values keep the order of their lists, this one's first.
+	// The merge is split among at most Threads threads, each one merging at least MinimumElementsPerThread elements.
+	// If Comp or a move throws, the lists keep their sizes, but the values merged so far are left moved-from.
+	template<typename Compare = std::less<T>> void merge(SListArray<value_type, Container>&& That, Compare Comp = Compare());
+	template<typename Compare = std::less<T>>
+	void merge(std::span<SListArray<value_type, Container>> Others, Compare Comp = Compare(), unsigned int Threads = std::thread::hardware_concurrency());
 	void clear();
-	void swap(SListArray<value_type>& That) noexcept;
+	void swap(SListArray<value_type, Container>& That) noexcept;
 
 	inline reference front() { return m_Data.back(); }
 	inline const_reference front() const { return m_Data.back(); }
 
 	inline bool empty() const { return m_Data.size() == 0; }
+	inline size_type size() const noexcept { return m_Data.size(); }
+	inline size_type max_size() const noexcept { return m_Data.max_size(); }
+
+	static constexpr size_type MinimumElementsPerThread = 64 * 1024;
 
 private:
 
-	std::vector<value_type> m_Data;
+	// A sorted sequence of elements, merged by MergeRuns().
+	struct Run
+	{
+		value_type* First;
+		value_type* Last;
+	};
+
+	// Passes each element of the merged runs to Output, moving it out of its run.
+	template<typename Compare, typename Emit> static void MergeRuns(std::vector<Run> Runs, Compare Comp, Emit&& Output);
+
+	template<typename Compare>
+	static void MergeInParallel(const std::vector<Run>& Runs, size_type Partitions, size_type NumberOfElements, Container& Merged, Compare Later);
+
+	void Reserve(size_type NumberOfElements);
+
+	Container m_Data;
 };
 
 
@@ -81,43 +127,41 @@ private:
 //////////////// METHODS IMPLEMENTATIONS ////////////////
 
 
-template<typename T>
-SListArray<T>::SListArray(size_type NumberOfElements) : SListArray<value_type>(NumberOfElements, value_type()) { }
+template<typename T, typename Container>
+SListArray<T, Container>::SListArray(size_type NumberOfElements) : SListArray<value_type, Container>(NumberOfElements, value_type()) { }
 
-template<typename T>
-SListArray<T>::SListArray(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+template<typename T, typename Container>
+SListArray<T, Container>::SListArray(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
 
-template<typename T>
-SListArray<T>::SListArray(std::initializer_list<value_type> IL) { assign(IL); }
+template<typename T, typename Container>
+SListArray<T, Container>::SListArray(std::initializer_list<value_type> IL) { assign(IL); }
 
-template<typename T>
-SListArray<T>::SListArray(const SListArray<value_type>& That)
-{
-	m_Data.reserve(That.m_Data.size());
+template<typename T, typename Container>
+template<std::input_iterator InputIt>
+SListArray<T, Container>::SListArray(InputIt First, InputIt Last) { assign(First, Last); }
 
-	for (const value_type& Value : That.m_Data)
-	{
-		push_front(Value);
-	}
-}
+// The vector already stores the elements in list order, so it can be copied as a whole:
+// for trivially copyable types this becomes a single memmove instead of a push_front per element.
+template<typename T, typename Container>
+SListArray<T, Container>::SListArray(const SListArray<value_type, Container>& That) : m_Data(That.m_Data) { }
 
-template<typename T>
-SListArray<T>::SListArray(SListArray<value_type>&& That) : m_Data(std::move(That.m_Data)) { }
+template<typename T, typename Container>
+SListArray<T, Container>::SListArray(SListArray<value_type, Container>&& That) : m_Data(std::move(That.m_Data)) { }
 
-template<typename T>
-SListArray<T>::~SListArray() { clear(); }
+template<typename T, typename Container>
+SListArray<T, Container>::~SListArray() { clear(); }
 
 
 
-template<typename T>
-auto SListArray<T>::operator=(SListArray<value_type> That) -> SListArray<value_type>&
+template<typename T, typename Container>
+auto SListArray<T, Container>::operator=(SListArray<value_type, Container> That) -> SListArray<value_type, Container>&
 {
 	std::swap(m_Data, That.m_Data);
 	return *this;
 }
 
-template<typename T>
-auto SListArray<T>::operator=(std::initializer_list<value_type> IL) -> SListArray<value_type>&
+template<typename T, typename Container>
+auto SListArray<T, Container>::operator=(std::initializer_list<value_type> IL) -> SListArray<value_type, Container>&
 {
 	assign(IL);
 	return *this;
@@ -126,53 +170,171 @@ auto SListArray<T>::operator=(std::initializer_list<value_type> IL) -> SListArra
 
 
 
-template<typename T>
-void SListArray<T>::assign(size_type NumberOfElements, const value_type& BaseValue)
+template<typename T, typename Container>
+void SListArray<T, Container>::assign(size_type NumberOfElements, const value_type& BaseValue)
 {
-	clear();
+	// Bulk fill, vectorized by the standard library for trivially copyable types.
+	m_Data.assign(NumberOfElements, BaseValue);
+}
 
-	m_Data.reserve(NumberOfElements);
+template<typename T, typename Container>
+void SListArray<T, Container>::assign(std::initializer_list<value_type> IL)
+{
+	// Pushing each value to the front stores them in the same order they have in IL, so they can be copied in bulk.
+	m_Data.assign(IL.begin(), IL.end());
+}
 
-	while (NumberOfElements > 0)
+// The range is copied in bulk, allocating once when its size is known, then reversed in place, so that its first element ends up at the highest index.
+template<typename T, typename Container>
+template<std::input_iterator InputIt>
+void SListArray<T, Container>::assign(InputIt First, InputIt Last)
+{
+	m_Data.assign(First, Last);
+	std::reverse(m_Data.data(), m_Data.data() + m_Data.size());
+}
+
+template<typename T, typename Container>
+void SListArray<T, Container>::push_front(const value_type& Value)
+{
+	m_Data.push_back(Value);
+}
+
+template<typename T, typename Container>
+void SListArray<T, Container>::pop_front()
+{
+	m_Data.pop_back();
+}
+
+// The front is at the back of the vector, so the range is appended from its last element, or reversed in place when it can't be walked backwards.
+// Containers supporting range insertion, like std::vector, copy the whole range at once: a single loop, vectorized for trivially copyable types.
+template<typename T, typename Container>
+template<std::input_iterator InputIt>
+void SListArray<T, Container>::push_front_range(InputIt First, InputIt Last)
+{
+	if constexpr (std::bidirectional_iterator<InputIt>)
 	{
-		push_front(BaseValue);
-		--NumberOfElements;
+		Reserve(m_Data.size() + static_cast<size_type>(std::distance(First, Last)));
+
+		if constexpr (requires { m_Data.insert(m_Data.end(), std::make_reverse_iterator(Last), std::make_reverse_iterator(First)); })
+		{
+			m_Data.insert(m_Data.end(), std::make_reverse_iterator(Last), std::make_reverse_iterator(First));
+		}
+		else
+		{
+			while (Last != First) m_Data.push_back(*--Last);
+		}
+	}
+	else
+	{
+		if constexpr (std::forward_iterator<InputIt>)
+		{
+			Reserve(m_Data.size() + static_cast<size_type>(std::distance(First, Last)));
+		}
+
+		const size_type OldSize = m_Data.size();
+		for (; First != Last; ++First) m_Data.push_back(*First);
+
+		std::reverse(m_Data.data() + OldSize, m_Data.data() + m_Data.size());
+	}
+}
+
+template<typename T, typename Container>
+void SListArray<T, Container>::push_front_n(size_type NumberOfElements, const value_type& Value)
+{
+	Reserve(m_Data.size() + NumberOfElements);
+
+	if constexpr (requires { m_Data.insert(m_Data.end(), NumberOfElements, Value); })
+	{
+		m_Data.insert(m_Data.end(), NumberOfElements, Value);
+	}
+	else
+	{
+		for (size_type i = 0; i < NumberOfElements; ++i) m_Data.push_back(Value);
 	}
 }
 
-template<typename T>
-void SListArray<T>::assign(std::initializer_list<value_type> IL)
+// The values are moved out from the back of the vector in a single loop, then their slots are destroyed all at once, when the container can erase a range.
+template<typename T, typename Container>
+template<std::output_iterator<T> OutputIt>
+OutputIt SListArray<T, Container>::pop_front_n(size_type NumberOfElements, OutputIt Output)
 {
-	clear();
+	NumberOfElements = std::min(NumberOfElements, m_Data.size());
 
-	m_Data.reserve(IL.size());
+	value_type* const Front = m_Data.data() + m_Data.size();
+	Output = std::move(std::make_reverse_iterator(Front), std::make_reverse_iterator(Front - NumberOfElements), Output);
 
-	for (const value_type& Value : IL)
+	if constexpr (requires { m_Data.erase(m_Data.end(), m_Data.end()); })
 	{
-		push_front(Value);
+		m_Data.erase(m_Data.end() - NumberOfElements, m_Data.end());
 	}
+	else
+	{
+		for (size_type i = 0; i < NumberOfElements; ++i) m_Data.pop_back();
+	}
+
+	return Output;
 }
 
-template<typename T>
-void SListArray<T>::push_front(const value_type& Value)
+template<typename T, typename Container>
+template<typename Compare>
+void SListArray<T, Container>::merge(SListArray<value_type, Container>&& That, Compare Comp)
 {
-	m_Data.push_back(Value);
+	merge(std::span<SListArray<value_type, Container>>(&That, 1), Comp);
 }
 
-template<typename T>
-void SListArray<T>::pop_front()
+// The vectors store the lists from back to front, so they're merged from back to front too, with the comparison reversed.
+// Their runs are listed from the last list to this one, so that ties, won by the first run, still end up in list order.
+template<typename T, typename Container>
+template<typename Compare>
+void SListArray<T, Container>::merge(std::span<SListArray<value_type, Container>> Others, Compare Comp, unsigned int Threads)
 {
-	m_Data.pop_back();
+	auto Later = [Comp](const value_type& A, const value_type& B) { return Comp(B, A); };
+
+	std::vector<Run> Runs;
+	size_type NumberOfElements = 0;
+
+	for (auto Other = Others.rbegin(); Other != Others.rend(); ++Other)
+	{
+		if (&*Other == this) continue;
+
+		Runs.push_back(Run{ Other->m_Data.data(), Other->m_Data.data() + Other->m_Data.size() });
+		NumberOfElements += Other->size();
+	}
+
+	Runs.push_back(Run{ m_Data.data(), m_Data.data() + m_Data.size() });
+	NumberOfElements += size();
+
+	const size_type Partitions = std::clamp<size_type>(NumberOfElements / MinimumElementsPerThread, 1, std::max(Threads, 1u));
+
+	Container Merged;
+
+	if (Partitions == 1)
+	{
+		// A single thread appends the elements right away, to storage reserved upfront.
+		Merged.reserve(NumberOfElements);
+		MergeRuns(std::move(Runs), Later, [&Merged](value_type&& Value) { Merged.push_back(std::move(Value)); });
+	}
+	else
+	{
+		MergeInParallel(Runs, Partitions, NumberOfElements, Merged, Later);
+	}
+
+	m_Data.swap(Merged);
+
+	for (SListArray<value_type, Container>& Other : Others)
+	{
+		if (&Other != this) Other.clear();
+	}
 }
 
-template<typename T>
-void SListArray<T>::clear()
+template<typename T, typename Container>
+void SListArray<T, Container>::clear()
 {
 	m_Data.clear();
 }
 
-template<typename T>
-void SListArray<T>::swap(SListArray<value_type>& That) noexcept
+template<typename T, typename Container>
+void SListArray<T, Container>::swap(SListArray<value_type, Container>& That) noexcept
 {
 	std::swap(m_Data, That.m_Data);
 }
@@ -180,11 +342,173 @@ void SListArray<T>::swap(SListArray<value_type>& That) noexcept
 
 
 
+// Grows geometrically, just like push_back(): reserving the exact size for each burst would reallocate the vector at every burst.
+template<typename T, typename Container>
+void SListArray<T, Container>::Reserve(size_type NumberOfElements)
+{
+	if (NumberOfElements > m_Data.capacity()) m_Data.reserve(std::max(NumberOfElements, 2 * m_Data.capacity()));
+}
+
+// Every element equal to or later than a splitter goes to the partition starting at that splitter, so each run is cut at the same splitters
+// with a binary search, and each partition is written right after the elements of all the previous ones, without any synchronization.
+//
+// The threads can't construct elements in the spare capacity of a container, so they construct them in an uninitialized buffer,
+// moved into Merged once they're all done: T doesn't need to be default constructible.
+// Each thread keeps its exception, if any, and all of them are joined before the first one is rethrown. A thread that can't be started
+// leaves its partition to this one.
+template<typename T, typename Container>
+template<typename Compare>
+void SListArray<T, Container>::MergeInParallel(const std::vector<Run>& Runs, size_type Partitions, size_type NumberOfElements, Container& Merged, Compare Later)
+{
+	// A few samples per partition, evenly spaced across all the runs, as if they were a single one, sorted to pick the splitters among them.
+	// Runs shorter than the stride still get their share of samples, since the positions carry over from one run to the next.
+	constexpr size_type SamplesPerPartition = 32;
+	const size_type Stride = std::max<size_type>(NumberOfElements / (Partitions * SamplesPerPartition), 1);
+
+	std::vector<const value_type*> Samples;
+	size_type NextSample = Stride / 2;
+	size_type RunStart = 0;
+
+	for (const Run& Sampled : Runs)
+	{
+		const size_type RunSize = static_cast<size_type>(Sampled.Last - Sampled.First);
+
+		for (; NextSample < RunStart + RunSize; NextSample += Stride) Samples.push_back(Sampled.First + (NextSample - RunStart));
+		RunStart += RunSize;
+	}
+
+	std::sort(Samples.begin(), Samples.end(), [&Later](const value_type* A, const value_type* B) { return Later(*A, *B); });
+
+	// Cuts[Partition][i] is the first element of Runs[i] in Partition, Offsets[Partition] its first position in the output.
+	std::vector<std::vector<value_type*>> Cuts(Partitions + 1, std::vector<value_type*>(Runs.size()));
+	std::vector<size_type> Offsets(Partitions + 1, 0);
+
+	for (size_type i = 0; i < Runs.size(); ++i)
+	{
+		Cuts[0][i] = Runs[i].First;
+		Cuts[Partitions][i] = Runs[i].Last;
+	}
+
+	for (size_type Partition = 1; Partition < Partitions; ++Partition)
+	{
+		const value_type& Splitter = *Samples[Partition * Samples.size() / Partitions];
+
+		for (size_type i = 0; i < Runs.size(); ++i)
+		{
+			Cuts[Partition][i] = std::lower_bound(Runs[i].First, Runs[i].Last, Splitter, Later);
+			Offsets[Partition] += static_cast<size_type>(Cuts[Partition][i] - Runs[i].First);
+		}
+	}
+
+	std::allocator<value_type> Allocator;
+	value_type* const Buffer = Allocator.allocate(NumberOfElements);
+
+	std::vector<size_type> Constructed(Partitions, 0);
+	std::vector<std::exception_ptr> Errors(Partitions);
+
+	auto MergePartition = [&](size_type Partition)
+	{
+		value_type* const Output = Buffer + Offsets[Partition];
+		size_type Count = 0;
+
+		try
+		{
+			std::vector<Run> Slices(Runs.size());
+			for (size_type i = 0; i < Runs.size(); ++i) Slices[i] = Run{ Cuts[Partition][i], Cuts[Partition + 1][i] };
+
+			MergeRuns(std::move(Slices), Later, [Output, &Count](value_type&& Value)
+			{
+				std::construct_at(Output + Count, std::move(Value));
+				++Count;
+			});
+		}
+		catch (...)
+		{
+			Errors[Partition] = std::current_exception();
+		}
+
+		Constructed[Partition] = Count;
+	};
+
+	std::vector<std::thread> Workers;
+
+	try
+	{
+		Workers.reserve(Partitions - 1);
+		for (size_type Partition = 1; Partition < Partitions; ++Partition) Workers.emplace_back(MergePartition, Partition);
+	}
+	catch (...)
+	{
+		// The partitions left without a thread are merged below, by this one.
+	}
+
+	MergePartition(0);
+	for (size_type Partition = Workers.size() + 1; Partition < Partitions; ++Partition) MergePartition(Partition);
+	for (std::thread& Worker : Workers) Worker.join();
+
+	std::exception_ptr Error;
+	for (const std::exception_ptr& PartitionError : Errors) if (Error == nullptr) Error = PartitionError;
+
+	if (Error == nullptr)
+	{
+		try
+		{
+			Merged.assign(std::make_move_iterator(Buffer), std::make_move_iterator(Buffer + NumberOfElements));
+		}
+		catch (...)
+		{
+			Error = std::current_exception();
+		}
+	}
+
+	for (size_type Partition = 0; Partition < Partitions; ++Partition) std::destroy_n(Buffer + Offsets[Partition], Constructed[Partition]);
+	Allocator.deallocate(Buffer, NumberOfElements);
+
+	if (Error != nullptr) std::rethrow_exception(Error);
+}
+
+template<typename T, typename Container>
+template<typename Compare, typename Emit>
+void SListArray<T, Container>::MergeRuns(std::vector<Run> Runs, Compare Comp, Emit&& Output)
+{
+	LoserTree<value_type, Compare> Tree(Runs.size(), Comp);
+	for (std::size_t i = 0; i < Runs.size(); ++i) Tree.Set(i, Runs[i].First != Runs[i].Last ? Runs[i].First : nullptr);
+	Tree.Build();
+
+	while (!Tree.Exhausted())
+	{
+		Run& Winner = Runs[Tree.Winner()];
+
+		Output(std::move(*Winner.First++));
+		Tree.Replace(Winner.First != Winner.Last ? Winner.First : nullptr);
+	}
+}
+
+
+
+
 namespace std
 {
-	template<typename T>
-	void swap(SListArray<T>& A, SListArray<T>& B) noexcept
+	template<typename T, typename Container>
+	void swap(SListArray<T, Container>& A, SListArray<T, Container>& B) noexcept
 	{
 		A.swap(B);
 	}
 }
+
+
+
+// std::vector<bool> packs its flags without exposing data(), so SIteratorArray couldn't walk it: flags are packed by PackedSListArray instead, one bit each.
+template<>
+class SListArray<bool> final : public PackedSListArray<bool, 1>
+{
+public:
+
+	using PackedSListArray<bool, 1>::PackedSListArray;
+	using PackedSListArray<bool, 1>::operator=;
+	using PackedSListArray<bool, 1>::merge;
+
+	// Lets a span of SListArray<bool> be merged, just like a span of any other SListArray.
+	template<typename Compare = std::less<bool>>
+	void merge(std::span<SListArray<bool>> Others, Compare Comp = Compare(), [[maybe_unused]] unsigned int Threads = 1) { MergeLists(Others, Comp); }
+};
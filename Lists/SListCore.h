@@ -0,0 +1,231 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+
+/**
+ * Link shared by the nodes of every SList, whatever their value type: SNode derives from it.
+ *
+ * @see SNode, SListCore
+ */
+struct SListLink
+{
+	SListLink* Next = nullptr;
+
+	SListLink() = default;
+	inline explicit SListLink(SListLink* _Next) : Next(_Next) { }
+};
+
+
+
+/**
+ * Non template core of SList, manipulating the chain of nodes only through their SListLinks.
+ *
+ * Linking, unlinking, reversing and splicing don't depend on the type of the values, so every SList instantiation calls into this same code,
+ * instead of generating an identical copy of it for each value type: SList only adds thin typed wrappers, allocating and destroying the nodes.
+ * Its functions are inline, so they're emitted once per program, just like a compilation unit's.
+ *
+ * It doesn't own the nodes: releasing them is up to SList.
+ *
+ * @see SList, SListLink
+ */
+class SListCore final
+{
+public:
+
+	SListCore() = default;
+	inline SListCore(SListCore&& That) noexcept : m_First(That.m_First), m_Last(That.m_Last), m_Size(That.m_Size) { That.Reset(); }
+	SListCore(const SListCore&) = delete;
+	SListCore& operator= (const SListCore&) = delete;
+
+
+	inline SListLink* First() const noexcept { return m_First; }
+	inline SListLink* Last() const noexcept { return m_Last; }
+	inline std::size_t Size() const noexcept { return m_Size; }
+
+
+	void PushFront(SListLink* Link) noexcept;
+	void PushBack(SListLink* Link) noexcept;
+	void InsertAfter(SListLink* Position, SListLink* Link) noexcept;
+	// Both return the unlinked node, or nullptr if there was none.
+	SListLink* PopFront() noexcept;
+	SListLink* EraseAfter(SListLink* Position) noexcept;
+
+	// Moves all of That's links at the end of this chain, or right after Position.
+	void Append(SListCore& That) noexcept;
+	void SpliceAfter(SListLink* Position, SListCore& That) noexcept;
+	// Moves the first Count links of this chain into Front, which must be empty: all of them, if there are fewer.
+	void SplitFront(std::size_t Count, SListCore& Front) noexcept;
+
+	void Reverse() noexcept;
+	void Swap(SListCore& That) noexcept;
+
+	// Detaches the whole chain, leaving the core empty, and returns its first link.
+	SListLink* Release() noexcept;
+
+	// Frees a detached chain of nodes allocated with new, each NodeSize bytes big, whose destructors are trivial.
+	static void DeallocateChain(SListLink* First, std::size_t NodeSize) noexcept;
+
+private:
+
+	inline void Reset() noexcept { m_First = nullptr; m_Last = nullptr; m_Size = 0; }
+
+	SListLink* m_First = nullptr;
+	SListLink* m_Last = nullptr;
+	std::size_t m_Size = 0;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+inline void SListCore::PushFront(SListLink* Link) noexcept
+{
+	Link->Next = m_First;
+
+	if (m_Last == nullptr) m_Last = Link;
+	m_First = Link;
+	++m_Size;
+}
+
+inline void SListCore::PushBack(SListLink* Link) noexcept
+{
+	Link->Next = nullptr;
+
+	if (m_Last == nullptr) m_First = Link;
+	else m_Last->Next = Link;
+
+	m_Last = Link;
+	++m_Size;
+}
+
+inline void SListCore::InsertAfter(SListLink* Position, SListLink* Link) noexcept
+{
+	Link->Next = Position->Next;
+	Position->Next = Link;
+
+	if (m_Last == Position) m_Last = Link;
+	++m_Size;
+}
+
+inline SListLink* SListCore::PopFront() noexcept
+{
+	SListLink* OldFirst = m_First;
+	if (OldFirst == nullptr) return nullptr;
+
+	m_First = OldFirst->Next;
+	if (m_First == nullptr) m_Last = nullptr;
+	--m_Size;
+
+	return OldFirst;
+}
+
+inline SListLink* SListCore::EraseAfter(SListLink* Position) noexcept
+{
+	SListLink* Erased = Position->Next;
+	if (Erased == nullptr) return nullptr;
+
+	Position->Next = Erased->Next;
+	if (m_Last == Erased) m_Last = Position;
+	--m_Size;
+
+	return Erased;
+}
+
+inline void SListCore::Append(SListCore& That) noexcept
+{
+	if (That.m_First == nullptr || &That == this) return;
+
+	if (m_Last == nullptr) m_First = That.m_First;
+	else m_Last->Next = That.m_First;
+
+	m_Last = That.m_Last;
+	m_Size += That.m_Size;
+
+	That.Reset();
+}
+
+inline void SListCore::SpliceAfter(SListLink* Position, SListCore& That) noexcept
+{
+	if (That.m_First == nullptr || &That == this) return;
+
+	That.m_Last->Next = Position->Next;
+	Position->Next = That.m_First;
+
+	if (m_Last == Position) m_Last = That.m_Last;
+	m_Size += That.m_Size;
+
+	That.Reset();
+}
+
+// Only the links being moved are walked, and not at all when moving the whole chain.
+inline void SListCore::SplitFront(std::size_t Count, SListCore& Front) noexcept
+{
+	if (Count == 0 || m_First == nullptr) return;
+
+	if (Count >= m_Size)
+	{
+		Swap(Front);
+		return;
+	}
+
+	SListLink* FrontLast = m_First;
+	for (std::size_t i = 1; i < Count; ++i) FrontLast = FrontLast->Next;
+
+	Front.m_First = m_First;
+	Front.m_Last = FrontLast;
+	Front.m_Size = Count;
+
+	m_First = FrontLast->Next;
+	m_Size -= Count;
+	FrontLast->Next = nullptr;
+}
+
+inline void SListCore::Reverse() noexcept
+{
+	SListLink* Previous = nullptr;
+	SListLink* Current = m_First;
+
+	m_Last = m_First;
+
+	while (Current != nullptr)
+	{
+		SListLink* Next = Current->Next;
+		Current->Next = Previous;
+		Previous = Current;
+		Current = Next;
+	}
+
+	m_First = Previous;
+}
+
+inline void SListCore::Swap(SListCore& That) noexcept
+{
+	std::swap(m_First, That.m_First);
+	std::swap(m_Last, That.m_Last);
+	std::swap(m_Size, That.m_Size);
+}
+
+inline SListLink* SListCore::Release() noexcept
+{
+	SListLink* Chain = m_First;
+	Reset();
+
+	return Chain;
+}
+
+inline void SListCore::DeallocateChain(SListLink* First, std::size_t NodeSize) noexcept
+{
+	while (First != nullptr)
+	{
+		SListLink* Next = First->Next;
+		::operator delete(First, NodeSize);
+		First = Next;
+	}
+}
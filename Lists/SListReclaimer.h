@@ -0,0 +1,175 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "SListCore.h"
+
+
+/**
+ * Simple support class used by SList, to destroy long chains of nodes on a background thread.
+ *
+ * SLists in deferred destruction mode detach their whole chain in O(1) when cleared or destroyed, and submit it here along with
+ * the function destroying it, instead of freeing each node on the calling thread.
+ * The reclaimer's thread takes every queued chain at once, as a batch, and destroys them outside of the lock, so submitting never waits for it.
+ *
+ * The queue is bounded: when it's full, or the reclaimer is stopping, Submit() refuses the chain, and the list destroys it synchronously instead.
+ * Its storage is reserved upfront, so submitting doesn't allocate either.
+ *
+ * There's a single reclaimer per program, started by the first list opting in. It's never destroyed, so that lists destroyed at any time,
+ * static ones included, can still reach it: at exit, Shutdown() destroys the chains left and stops its thread, and from then on Submit()
+ * refuses every chain.
+ *
+ * @see SList, SListCore
+ */
+class SListReclaimer final
+{
+public:
+
+	using DestroyFunction = void (*)(SListLink*) noexcept;
+
+	// Maximum number of chains waiting to be destroyed.
+	static constexpr std::size_t QueueCapacity = 64;
+	// Shorter chains are destroyed right away: queueing them would cost about as much as freeing their nodes.
+	static constexpr std::size_t MinimumDeferredSize = 1024;
+
+
+	static SListReclaimer& Instance();
+
+	SListReclaimer(const SListReclaimer&) = delete;
+	SListReclaimer& operator= (const SListReclaimer&) = delete;
+
+
+	// Queues a detached chain, to be destroyed by Destroy. Returns false without taking it if the queue is full.
+	bool Submit(SListLink* First, DestroyFunction Destroy);
+
+	// Waits until every chain submitted so far has been destroyed.
+	void Flush();
+
+	std::size_t Pending() const;
+
+	// Destroys the chains left, then stops the thread. Later chains are refused, and destroyed synchronously by their lists.
+	// Called at exit, it can be called earlier too; calls after the first one do nothing.
+	void Shutdown();
+
+private:
+
+	struct Chain
+	{
+		SListLink* First;
+		DestroyFunction Destroy;
+	};
+
+	SListReclaimer();
+	~SListReclaimer() = default; // Never called, see Instance().
+
+	void Run();
+
+	mutable std::mutex m_Mutex;
+	std::condition_variable m_Submitted;
+	std::condition_variable m_Reclaimed;
+
+	std::vector<Chain> m_Queue;
+	// Swapped with m_Queue to take all of its chains at once, and cleared, by the reclaimer's thread under the lock.
+	// Then it's only read: by the thread destroying its chains outside of the lock, and by Flush() and Pending() under it.
+	std::vector<Chain> m_Batch;
+	bool m_Stopping = false;
+
+	std::thread m_Thread;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+// Allocated on first use and never destroyed: a static list destroyed after the exit handler still finds it, just stopped.
+// Its mutex and queues stay valid, so it isn't affected by the order in which statics are destroyed.
+inline SListReclaimer& SListReclaimer::Instance()
+{
+	static SListReclaimer& Reclaimer = []() -> SListReclaimer&
+	{
+		SListReclaimer* Created = new SListReclaimer;
+		std::atexit([]() { Instance().Shutdown(); });
+		return *Created;
+	}();
+
+	return Reclaimer;
+}
+
+inline SListReclaimer::SListReclaimer()
+{
+	m_Queue.reserve(QueueCapacity);
+	m_Batch.reserve(QueueCapacity);
+
+	m_Thread = std::thread([this]() { Run(); });
+}
+
+inline void SListReclaimer::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		if (m_Stopping) return;
+
+		m_Stopping = true;
+	}
+
+	m_Submitted.notify_one();
+	m_Thread.join();
+}
+
+
+
+inline bool SListReclaimer::Submit(SListLink* First, DestroyFunction Destroy)
+{
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		if (m_Stopping || m_Queue.size() == QueueCapacity) return false;
+
+		m_Queue.push_back(Chain{ First, Destroy });
+	}
+
+	m_Submitted.notify_one();
+	return true;
+}
+
+inline void SListReclaimer::Flush()
+{
+	std::unique_lock<std::mutex> Lock(m_Mutex);
+	m_Reclaimed.wait(Lock, [this]() { return m_Queue.empty() && m_Batch.empty(); });
+}
+
+inline std::size_t SListReclaimer::Pending() const
+{
+	std::lock_guard<std::mutex> Lock(m_Mutex);
+	return m_Queue.size() + m_Batch.size();
+}
+
+
+
+// Keeps going until it's stopping and no chain is left, so none is leaked at exit.
+inline void SListReclaimer::Run()
+{
+	std::unique_lock<std::mutex> Lock(m_Mutex);
+
+	while (true)
+	{
+		m_Submitted.wait(Lock, [this]() { return m_Stopping || !m_Queue.empty(); });
+		if (m_Queue.empty()) return;
+
+		m_Batch.swap(m_Queue);
+		Lock.unlock();
+
+		for (const Chain& Submitted : m_Batch) Submitted.Destroy(Submitted.First);
+
+		Lock.lock();
+		m_Batch.clear();
+		m_Reclaimed.notify_all();
+	}
+}
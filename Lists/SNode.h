@@ -2,22 +2,26 @@
 
 #pragma once
 
+#include "SListCore.h"
+
 
 /**
  * Simple support struct used by SList, to implement a Forward List.
  * Could be further improved by implementing move semantics and swap.
+ *
+ * Its link, inherited from SListLink, is the same for every value type, so SList can manipulate its chain through the non template SListCore.
+ * NextNode() gives back the next node with its type.
  * 
- * @see SList
+ * @see SList, SListLink, SListCore
  */
 template<typename T>
-struct SNode final
+struct SNode final : SListLink
 {
-	SNode<T>* Next = nullptr;
 	T Data;
 
 	SNode() = delete;
-	inline SNode(SNode<T>* _Next, const T& _Data) : Next(_Next), Data(_Data) { }
-	inline SNode(const SNode<T>& That) : Next(That.Next), Data(That.Data) { }
+	inline SNode(SListLink* _Next, const T& _Data) : SListLink(_Next), Data(_Data) { }
+	inline SNode(const SNode<T>& That) : SListLink(That.Next), Data(That.Data) { }
 
 	inline SNode<T>& operator= (const SNode<T>& That)
 	{
@@ -25,4 +29,6 @@ struct SNode final
 		Data = That.Data;
 		return *this;
 	}
+
+	inline SNode<T>* NextNode() const { return static_cast<SNode<T>*>(Next); }
 };
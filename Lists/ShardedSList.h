@@ -0,0 +1,201 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "SList.h"
+#include "ShardedSIterator.h"
+
+
+/**
+ * Forward List, pushed to by many threads at once.
+ *
+ * Splits its elements among several shards, each one an SList with its own lock, aligned to a cache line of its own.
+ * Every thread always pushes to the same shard, picked once per thread, so as long as there are at least as many shards as pushing threads
+ * no two threads ever touch the same cache line, and every lock is uncontended.
+ * By default there is one shard per hardware thread.
+ *
+ * The order of the elements is kept only within each shard: the merged view returned by cbegin() and cend() visits the shards one after another,
+ * through a ConstShardedSIterator. The view must not be used while other threads push.
+ * drain() moves all the elements into a single SList, relinking the shards' nodes without copying them.
+ * size() is approximate while other threads push, since each shard's counter is read at a different time.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SList, ConstShardedSIterator
+ */
+template<typename T>
+class ShardedSList final
+{
+	struct alignas(64) Shard
+	{
+		std::mutex Mutex;
+		SList<T> List;
+		std::atomic<std::size_t> NumberOfElements = 0; // Mirrors List.size(), so that size() can read it without locking.
+	};
+
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = const T&;
+	using const_reference  = const T&;
+	using pointer          = const T*;
+	using const_pointer    = const T*;
+	using iterator         = ConstShardedSIterator<value_type, Shard>;
+	using const_iterator   = ConstShardedSIterator<value_type, Shard>;
+
+
+	ShardedSList() : ShardedSList<value_type>(DefaultNumberOfShards()) { }
+	explicit ShardedSList(size_type NumberOfShards);
+	// Shards own a mutex, so the list can be moved but not copied.
+	// A moved-from list has no shards: it's empty, and must be assigned to before pushing to it again.
+	ShardedSList(const ShardedSList<value_type>&) = delete;
+	ShardedSList(ShardedSList<value_type>&& That) noexcept;
+	~ShardedSList() = default;
+
+
+	ShardedSList<value_type>& operator= (const ShardedSList<value_type>&) = delete;
+	ShardedSList<value_type>& operator= (ShardedSList<value_type>&& That) noexcept;
+
+
+	inline const_iterator begin() const noexcept { return const_iterator(m_Shards.get(), m_Shards.get() + m_NumberOfShards); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(m_Shards.get(), m_Shards.get() + m_NumberOfShards); }
+
+	inline const_iterator end() const noexcept { return const_iterator(m_Shards.get() + m_NumberOfShards, m_Shards.get() + m_NumberOfShards); }
+	inline const_iterator cend() const noexcept { return const_iterator(m_Shards.get() + m_NumberOfShards, m_Shards.get() + m_NumberOfShards); }
+
+
+	// Thread safe.
+
+	void push_front(const value_type& Value);
+	[[nodiscard]] SList<value_type> drain();
+	void clear();
+
+	size_type size() const noexcept;
+	inline bool empty() const noexcept { return size() == 0; }
+	inline size_type shard_count() const noexcept { return m_NumberOfShards; }
+
+private:
+
+	static size_type DefaultNumberOfShards() noexcept;
+
+	// Gives each thread a different index, the first time it's asked for.
+	static size_type ThreadIndex() noexcept;
+
+	std::unique_ptr<Shard[]> m_Shards;
+	size_type m_NumberOfShards = 0;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+ShardedSList<T>::ShardedSList(size_type NumberOfShards)
+	: m_Shards(new Shard[NumberOfShards > 0 ? NumberOfShards : 1]), m_NumberOfShards(NumberOfShards > 0 ? NumberOfShards : 1) { }
+
+template<typename T>
+ShardedSList<T>::ShardedSList(ShardedSList<value_type>&& That) noexcept
+	: m_Shards(std::move(That.m_Shards)), m_NumberOfShards(std::exchange(That.m_NumberOfShards, 0)) { }
+
+
+
+
+template<typename T>
+ShardedSList<T>& ShardedSList<T>::operator= (ShardedSList<value_type>&& That) noexcept
+{
+	if (this != &That)
+	{
+		m_Shards = std::move(That.m_Shards);
+		m_NumberOfShards = std::exchange(That.m_NumberOfShards, 0);
+	}
+
+	return *this;
+}
+
+
+
+
+template<typename T>
+void ShardedSList<T>::push_front(const value_type& Value)
+{
+	if (m_NumberOfShards == 0) throw std::logic_error("ShardedSList can't push to a moved-from list.");
+
+	Shard& ThreadShard = m_Shards[ThreadIndex() % m_NumberOfShards];
+
+	std::lock_guard<std::mutex> Lock(ThreadShard.Mutex);
+	ThreadShard.List.push_front(Value);
+	ThreadShard.NumberOfElements.store(ThreadShard.List.size(), std::memory_order_relaxed);
+}
+
+template<typename T>
+SList<T> ShardedSList<T>::drain()
+{
+	SList<value_type> Drained;
+
+	for (size_type i = 0; i < m_NumberOfShards; ++i)
+	{
+		std::lock_guard<std::mutex> Lock(m_Shards[i].Mutex);
+		Drained.append(std::move(m_Shards[i].List));
+		m_Shards[i].NumberOfElements.store(0, std::memory_order_relaxed);
+	}
+
+	return Drained;
+}
+
+template<typename T>
+void ShardedSList<T>::clear()
+{
+	for (size_type i = 0; i < m_NumberOfShards; ++i)
+	{
+		SList<value_type> Cleared;
+
+		{
+			std::lock_guard<std::mutex> Lock(m_Shards[i].Mutex);
+			Cleared.swap(m_Shards[i].List);
+			m_Shards[i].NumberOfElements.store(0, std::memory_order_relaxed);
+		}
+
+		// The nodes are freed by Cleared's destructor, after the shard has been unlocked.
+	}
+}
+
+template<typename T>
+auto ShardedSList<T>::size() const noexcept -> size_type
+{
+	size_type Size = 0;
+
+	for (size_type i = 0; i < m_NumberOfShards; ++i)
+	{
+		Size += m_Shards[i].NumberOfElements.load(std::memory_order_relaxed);
+	}
+
+	return Size;
+}
+
+
+
+template<typename T>
+auto ShardedSList<T>::DefaultNumberOfShards() noexcept -> size_type
+{
+	const unsigned int HardwareThreads = std::thread::hardware_concurrency();
+	return HardwareThreads > 0 ? HardwareThreads : 1;
+}
+
+template<typename T>
+auto ShardedSList<T>::ThreadIndex() noexcept -> size_type
+{
+	static std::atomic<size_type> NextIndex = 0;
+	thread_local const size_type Index = NextIndex.fetch_add(1, std::memory_order_relaxed);
+
+	return Index;
+}
@@ -0,0 +1,49 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+
+/**
+ * Support struct used by PersistentSList, to implement an immutable Forward List whose tails are shared between lists.
+ * Just like SNode it wraps a templated datatype and a pointer to the next node, but it also counts the references to itself.
+ *
+ * RefCount counts both the lists whose first node is this one and the nodes whose Next is this one.
+ * It is atomic, so lists sharing their nodes can be copied and destroyed from different threads.
+ *
+ * @see PersistentSList, SNode
+ */
+template<typename T>
+struct SharedSNode final
+{
+	SharedSNode<T>* Next = nullptr;
+	const T Data;
+	std::atomic<std::size_t> RefCount;
+
+	SharedSNode() = delete;
+	SharedSNode(const SharedSNode<T>&) = delete;
+	SharedSNode<T>& operator= (const SharedSNode<T>&) = delete;
+
+	// Takes ownership of the reference to _Next held by the caller.
+	inline SharedSNode(SharedSNode<T>* _Next, const T& _Data) : Next(_Next), Data(_Data), RefCount(1) { }
+
+
+	static inline void AddReference(SharedSNode<T>* Node) noexcept
+	{
+		if (Node != nullptr) Node->RefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Releases a reference to Node, deleting it and every following node left without references.
+	// It's a loop rather than a recursion through the destructors, so that long chains cannot overflow the stack.
+	static inline void RemoveReference(SharedSNode<T>* Node) noexcept
+	{
+		while (Node != nullptr && Node->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			SharedSNode<T>* NextNode = Node->Next;
+			delete Node;
+			Node = NextNode;
+		}
+	}
+};
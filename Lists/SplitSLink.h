@@ -0,0 +1,37 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstdint>
+
+
+/**
+ * Simple support struct used by SplitSList, to implement a Forward List whose links are stored apart from the values.
+ * It contains the index of the next link and, optionally, a copy of a frequently read field of the value, called the hot field.
+ * The value itself is stored in another array, at the same index of its link.
+ *
+ * @see SplitSList, CompactSNode
+ */
+template<typename HotType>
+struct SplitSLink final
+{
+	using index_type = std::uint32_t;
+
+	static constexpr index_type NullIndex = UINT32_MAX;
+
+	index_type Next = NullIndex;
+	HotType Hot;
+};
+
+/**
+ * Link of a SplitSList without a hot field: just the index of the next link.
+ */
+template<>
+struct SplitSLink<void> final
+{
+	using index_type = std::uint32_t;
+
+	static constexpr index_type NullIndex = UINT32_MAX;
+
+	index_type Next = NullIndex;
+};
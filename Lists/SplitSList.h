@@ -0,0 +1,396 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SplitSLink.h"
+#include "SplitSIterator.h"
+
+
+/**
+ * Type of the hot field stored in the links of a SplitSList: the result of Projection applied to a value, or void without a Projection.
+ */
+template<typename T, typename Projection>
+struct SplitSHotType
+{
+	using type = std::remove_cvref_t<std::invoke_result_t<Projection, const T&>>;
+};
+
+template<typename T>
+struct SplitSHotType<T, void>
+{
+	using type = void;
+};
+
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * Just like CompactSList, its elements link each other through 32 bit indices, but the links and the values are kept in two different std vectors:
+ * walking the list reads only the dense array of links, and a value is brought into the cache only when it's actually read.
+ * This pays off when the values are large records, and only a few of them are read during a scan.
+ *
+ * Optionally, a Projection can be given: it's a default constructible function object taking a value and returning one of its fields,
+ * the hot field, which is then stored in the link next to the index of the next element.
+ * find_if_hot(), count_if_hot() and find_if() can then scan the list testing the hot field, reading a value only when the hot field matches.
+ * Since a modified value would leave its hot field stale, lists with a Projection only give const access to their values.
+ *
+ * Uses a custom forward iterator class, called SplitSIterator, which follows the links.
+ * Just like std::vector's iterators, they are invalidated when the list grows.
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SplitSLink, SplitSIterator, CompactSList
+ */
+template<typename T, typename Projection = void>
+class SplitSList final
+{
+public:
+
+	static constexpr bool HasHotField = !std::is_void_v<Projection>;
+
+	using hot_type         = typename SplitSHotType<T, Projection>::type;
+	using link_type        = SplitSLink<hot_type>;
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = std::conditional_t<HasHotField, const T&, T&>;
+	using const_reference  = const T&;
+	using pointer          = std::conditional_t<HasHotField, const T*, T*>;
+	using const_pointer    = const T*;
+	using iterator         = std::conditional_t<HasHotField, ConstSplitSIterator<value_type, link_type>, SplitSIterator<value_type, link_type>>;
+	using const_iterator   = ConstSplitSIterator<value_type, link_type>;
+
+
+	SplitSList() = default;
+	SplitSList(size_type NumberOfElements);
+	SplitSList(size_type NumberOfElements, const value_type& BaseValue);
+	SplitSList(std::initializer_list<value_type> IL);
+	SplitSList(const SplitSList<value_type, Projection>& That);
+	SplitSList(SplitSList<value_type, Projection>&& That) noexcept;
+	~SplitSList() = default;
+
+
+	SplitSList<value_type, Projection>& operator= (SplitSList<value_type, Projection> That) noexcept; // copy-and-swap idiom.
+	SplitSList<value_type, Projection>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+
+	inline iterator begin() noexcept { return iterator(m_Links.data(), m_Data.data(), m_FirstNode); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<link_type*>(m_Links.data()), const_cast<value_type*>(m_Data.data()), m_FirstNode); }
+
+	inline iterator end() noexcept { return iterator(m_Links.data(), m_Data.data(), link_type::NullIndex); }
+	inline const_iterator cend() const noexcept { return const_iterator(const_cast<link_type*>(m_Links.data()), const_cast<value_type*>(m_Data.data()), link_type::NullIndex); }
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	void push_front(const value_type& Value);
+	void pop_front();
+	void clear() noexcept;
+	void swap(SplitSList<value_type, Projection>& That) noexcept;
+
+	inline reference front() { return m_Data[m_FirstNode]; }
+	inline const_reference front() const { return m_Data[m_FirstNode]; }
+
+	inline bool empty() const { return m_FirstNode == link_type::NullIndex; }
+	inline size_type size() const noexcept { return m_NumberOfElements; }
+	inline size_type max_size() const noexcept { return link_type::NullIndex; }
+
+
+	// Walks Position links, without reading any value.
+	const_iterator nth(size_type Position) const;
+
+	// The following ones can be used only by lists with a Projection.
+
+	// Returns the first element whose hot field satisfies HotPredicate, reading only the links.
+	template<typename HotPredicate>
+	const_iterator find_if_hot(HotPredicate Predicate) const;
+
+	// Counts the elements whose hot field satisfies HotPredicate, reading only the links.
+	template<typename HotPredicate>
+	size_type count_if_hot(HotPredicate Predicate) const;
+
+	// Returns the first element whose hot field satisfies HotPredicate and whose value satisfies ValuePredicate.
+	// A value is read only if its hot field satisfies HotPredicate.
+	template<typename HotPredicate, typename ValuePredicate>
+	const_iterator find_if(HotPredicate HotPred, ValuePredicate ValuePred) const;
+
+private:
+
+	using index_type = typename link_type::index_type;
+
+	index_type AllocateElement(const value_type& Value);
+
+	std::vector<link_type> m_Links;
+	std::vector<value_type> m_Data; // m_Data[i] is the value of the element linked by m_Links[i].
+	index_type m_FirstNode = link_type::NullIndex;
+	index_type m_FreeNodes = link_type::NullIndex; // Popped elements, linked through Next.
+	index_type m_NumberOfElements = 0;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T, typename Projection>
+SplitSList<T, Projection>::SplitSList(size_type NumberOfElements) : SplitSList<value_type, Projection>(NumberOfElements, value_type()) { }
+
+template<typename T, typename Projection>
+SplitSList<T, Projection>::SplitSList(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+
+template<typename T, typename Projection>
+SplitSList<T, Projection>::SplitSList(std::initializer_list<value_type> IL) { assign(IL); }
+
+// The copy is compacted: its elements are stored in list order, without the free ones, so both arrays are traversed sequentially.
+template<typename T, typename Projection>
+SplitSList<T, Projection>::SplitSList(const SplitSList<value_type, Projection>& That)
+{
+	m_Links.reserve(That.m_NumberOfElements);
+	m_Data.reserve(That.m_NumberOfElements);
+
+	for (index_type That_CurrentNode = That.m_FirstNode; That_CurrentNode != link_type::NullIndex; That_CurrentNode = That.m_Links[That_CurrentNode].Next)
+	{
+		const index_type NewNode = static_cast<index_type>(m_Links.size());
+
+		m_Data.push_back(That.m_Data[That_CurrentNode]);
+		m_Links.push_back(That.m_Links[That_CurrentNode]);
+		m_Links.back().Next = (NewNode + 1 < That.m_NumberOfElements) ? NewNode + 1 : link_type::NullIndex;
+	}
+
+	m_NumberOfElements = That.m_NumberOfElements;
+	m_FirstNode = m_Links.empty() ? link_type::NullIndex : 0;
+}
+
+template<typename T, typename Projection>
+SplitSList<T, Projection>::SplitSList(SplitSList<value_type, Projection>&& That) noexcept
+	: m_Links(std::move(That.m_Links)), m_Data(std::move(That.m_Data)),
+	  m_FirstNode(That.m_FirstNode), m_FreeNodes(That.m_FreeNodes), m_NumberOfElements(That.m_NumberOfElements)
+{
+	That.clear();
+}
+
+
+
+template<typename T, typename Projection>
+auto SplitSList<T, Projection>::operator= (SplitSList<value_type, Projection> That) noexcept -> SplitSList<value_type, Projection>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T, typename Projection>
+auto SplitSList<T, Projection>::operator= (std::initializer_list<value_type> IL) -> SplitSList<value_type, Projection>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T, typename Projection>
+void SplitSList<T, Projection>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	clear();
+
+	m_Links.reserve(NumberOfElements);
+	m_Data.reserve(NumberOfElements);
+
+	while (NumberOfElements > 0)
+	{
+		push_front(BaseValue);
+		--NumberOfElements;
+	}
+}
+
+template<typename T, typename Projection>
+void SplitSList<T, Projection>::assign(std::initializer_list<value_type> IL)
+{
+	clear();
+
+	m_Links.reserve(IL.size());
+	m_Data.reserve(IL.size());
+
+	for (const value_type& Value : IL)
+	{
+		push_front(Value);
+	}
+}
+
+template<typename T, typename Projection>
+void SplitSList<T, Projection>::push_front(const value_type& Value)
+{
+	const index_type NewNode = AllocateElement(Value);
+
+	m_Links[NewNode].Next = m_FirstNode;
+
+	if constexpr (HasHotField)
+	{
+		m_Links[NewNode].Hot = std::invoke(Projection(), m_Data[NewNode]);
+	}
+
+	m_FirstNode = NewNode;
+	++m_NumberOfElements;
+}
+
+template<typename T, typename Projection>
+void SplitSList<T, Projection>::pop_front()
+{
+	if (m_FirstNode != link_type::NullIndex)
+	{
+		const index_type OldFirstNode = m_FirstNode;
+		m_FirstNode = m_Links[OldFirstNode].Next;
+
+		// The last element of the arrays is never in the free list, so it can be removed right away.
+		if (OldFirstNode == m_Links.size() - 1)
+		{
+			m_Links.pop_back();
+			m_Data.pop_back();
+		}
+		else
+		{
+			m_Links[OldFirstNode].Next = m_FreeNodes;
+			m_FreeNodes = OldFirstNode;
+		}
+
+		--m_NumberOfElements;
+	}
+}
+
+template<typename T, typename Projection>
+void SplitSList<T, Projection>::clear() noexcept
+{
+	m_Links.clear();
+	m_Data.clear();
+	m_FirstNode = link_type::NullIndex;
+	m_FreeNodes = link_type::NullIndex;
+	m_NumberOfElements = 0;
+}
+
+template<typename T, typename Projection>
+void SplitSList<T, Projection>::swap(SplitSList<value_type, Projection>& That) noexcept
+{
+	std::swap(m_Links, That.m_Links);
+	std::swap(m_Data, That.m_Data);
+	std::swap(m_FirstNode, That.m_FirstNode);
+	std::swap(m_FreeNodes, That.m_FreeNodes);
+	std::swap(m_NumberOfElements, That.m_NumberOfElements);
+}
+
+
+
+
+template<typename T, typename Projection>
+auto SplitSList<T, Projection>::nth(size_type Position) const -> const_iterator
+{
+	index_type CurrentNode = m_FirstNode;
+
+	for (; Position > 0 && CurrentNode != link_type::NullIndex; --Position)
+	{
+		CurrentNode = m_Links[CurrentNode].Next;
+	}
+
+	return const_iterator(const_cast<link_type*>(m_Links.data()), const_cast<value_type*>(m_Data.data()), CurrentNode);
+}
+
+template<typename T, typename Projection>
+template<typename HotPredicate>
+auto SplitSList<T, Projection>::find_if_hot(HotPredicate Predicate) const -> const_iterator
+{
+	static_assert(HasHotField, "find_if_hot() requires a SplitSList with a Projection.");
+
+	index_type CurrentNode = m_FirstNode;
+
+	while (CurrentNode != link_type::NullIndex && !Predicate(m_Links[CurrentNode].Hot))
+	{
+		CurrentNode = m_Links[CurrentNode].Next;
+	}
+
+	return const_iterator(const_cast<link_type*>(m_Links.data()), const_cast<value_type*>(m_Data.data()), CurrentNode);
+}
+
+template<typename T, typename Projection>
+template<typename HotPredicate>
+auto SplitSList<T, Projection>::count_if_hot(HotPredicate Predicate) const -> size_type
+{
+	static_assert(HasHotField, "count_if_hot() requires a SplitSList with a Projection.");
+
+	size_type Count = 0;
+
+	for (index_type CurrentNode = m_FirstNode; CurrentNode != link_type::NullIndex; CurrentNode = m_Links[CurrentNode].Next)
+	{
+		if (Predicate(m_Links[CurrentNode].Hot)) ++Count;
+	}
+
+	return Count;
+}
+
+template<typename T, typename Projection>
+template<typename HotPredicate, typename ValuePredicate>
+auto SplitSList<T, Projection>::find_if(HotPredicate HotPred, ValuePredicate ValuePred) const -> const_iterator
+{
+	static_assert(HasHotField, "find_if() requires a SplitSList with a Projection.");
+
+	index_type CurrentNode = m_FirstNode;
+
+	while (CurrentNode != link_type::NullIndex && !(HotPred(m_Links[CurrentNode].Hot) && ValuePred(m_Data[CurrentNode])))
+	{
+		CurrentNode = m_Links[CurrentNode].Next;
+	}
+
+	return const_iterator(const_cast<link_type*>(m_Links.data()), const_cast<value_type*>(m_Data.data()), CurrentNode);
+}
+
+
+
+// Returns the index of a new element holding Value: a recycled one if available, otherwise a new one at the end of both arrays.
+template<typename T, typename Projection>
+auto SplitSList<T, Projection>::AllocateElement(const value_type& Value) -> index_type
+{
+	if (m_FreeNodes != link_type::NullIndex)
+	{
+		const index_type NewNode = m_FreeNodes;
+		m_Data[NewNode] = Value;
+		m_FreeNodes = m_Links[NewNode].Next;
+		return NewNode;
+	}
+
+	if (m_Links.size() >= link_type::NullIndex) throw std::length_error("SplitSList can't hold more than 2^32 - 1 elements.");
+
+	m_Links.emplace_back();
+
+	try
+	{
+		m_Data.push_back(Value);
+	}
+	catch (...)
+	{
+		m_Links.pop_back();
+		throw;
+	}
+
+	return static_cast<index_type>(m_Links.size() - 1);
+}
+
+
+
+
+namespace std
+{
+	template<typename T, typename Projection>
+	void swap(SplitSList<T, Projection>& A, SplitSList<T, Projection>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,301 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "TombstoneSIterator.h"
+
+
+/**
+ * Forward List, compatible with stl and its algorithms.
+ *
+ * A variant of SListArray whose elements can also be erased from the middle of the list, in amortized O(1).
+ * Erased slots are not removed from the std vector: they're only marked as tombstones in a side bitmap, one bit per slot,
+ * and skipped by its iterators, which scan the bitmap a word at a time.
+ * Once the tombstones exceed a configurable ratio of the slots, the vector is compacted in a single pass, removing all of them at once.
+ *
+ * The slot with the highest index, the front of the list, is never a tombstone: tombstones reaching the top of the vector are popped right away.
+ *
+ * Uses a custom forward iterator class, called TombstoneSIterator. Just like std::vector's iterators, they're all invalidated by erase().
+ *
+ * Note: just like std containers, it won't delete user allocated's memory!
+ *
+ * @see SListArray, TombstoneSIterator
+ */
+template<typename T>
+class TombstoneSListArray final
+{
+public:
+
+	using value_type       = T;
+	using size_type        = std::size_t;
+	using reference        = T&;
+	using const_reference  = const T&;
+	using pointer          = T*;
+	using const_pointer    = const T*;
+	using iterator         = TombstoneSIterator<value_type>;
+	using const_iterator   = ConstTombstoneSIterator<value_type>;
+
+	// Ratio of tombstones to slots above which erase() compacts the vector, when not configured otherwise.
+	static constexpr double DefaultMaxTombstoneRatio = 0.25;
+
+
+	TombstoneSListArray() = default;
+	TombstoneSListArray(size_type NumberOfElements);
+	TombstoneSListArray(size_type NumberOfElements, const value_type& BaseValue);
+	TombstoneSListArray(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> TombstoneSListArray(InputIt First, InputIt Last);
+	TombstoneSListArray(const TombstoneSListArray<value_type>& That) = default;
+	TombstoneSListArray(TombstoneSListArray<value_type>&& That) noexcept;
+	~TombstoneSListArray() = default;
+
+
+	TombstoneSListArray<value_type>& operator= (TombstoneSListArray<value_type> That) noexcept; // copy-and-swap idiom.
+	TombstoneSListArray<value_type>& operator= (std::initializer_list<value_type> IL);
+
+
+	// cbegin() and cend() employ a const_cast in order to initialize the const_iterator.
+	// This is safe, because the const_iterator does not modify its value.
+
+	inline iterator begin() noexcept { return iterator(m_Data.data(), m_Tombstones.data(), LastSlotIndex()); }
+	inline const_iterator cbegin() const noexcept { return const_iterator(const_cast<value_type*>(m_Data.data()), m_Tombstones.data(), LastSlotIndex()); }
+
+	inline iterator end() noexcept { return iterator(m_Data.data(), m_Tombstones.data(), -1); }
+	inline const_iterator cend() const noexcept { return const_iterator(const_cast<value_type*>(m_Data.data()), m_Tombstones.data(), -1); }
+
+
+	void assign(size_type NumberOfElements, const value_type& BaseValue);
+	void assign(std::initializer_list<value_type> IL);
+	template<std::input_iterator InputIt> void assign(InputIt First, InputIt Last); // Keeps the order of the range: First becomes the front.
+	void push_front(const value_type& Value);
+	void pop_front();
+	// Returns an iterator to the element following the erased one, invalidating every other iterator.
+	iterator erase(const_iterator Position);
+	void compact();
+	void clear();
+	void swap(TombstoneSListArray<value_type>& That) noexcept;
+
+	inline reference front() { return m_Data.back(); }
+	inline const_reference front() const { return m_Data.back(); }
+
+	inline bool empty() const { return size() == 0; }
+	inline size_type size() const noexcept { return m_Data.size() - m_NumberOfTombstones; }
+	inline size_type max_size() const noexcept { return m_Data.max_size(); }
+	inline size_type tombstone_count() const noexcept { return m_NumberOfTombstones; }
+
+	inline double max_tombstone_ratio() const noexcept { return m_MaxTombstoneRatio; }
+	inline void set_max_tombstone_ratio(double Ratio) noexcept { m_MaxTombstoneRatio = Ratio; }
+
+private:
+
+	using index_type = long long int;
+
+	inline index_type LastSlotIndex() const noexcept { return static_cast<index_type>(m_Data.size()) - 1; }
+	inline bool IsTombstone(size_type Slot) const noexcept { return (m_Tombstones[Slot / 64] & const_iterator::SlotBit(Slot)) != 0; }
+
+	void PopSlot();
+	void PopTopTombstones();
+
+	std::vector<value_type> m_Data;
+	std::vector<std::uint64_t> m_Tombstones; // One bit per slot of m_Data, set for the erased ones.
+	size_type m_NumberOfTombstones = 0;
+	double m_MaxTombstoneRatio = DefaultMaxTombstoneRatio;
+};
+
+
+
+
+//////////////// METHODS IMPLEMENTATIONS ////////////////
+
+
+template<typename T>
+TombstoneSListArray<T>::TombstoneSListArray(size_type NumberOfElements) : TombstoneSListArray<value_type>(NumberOfElements, value_type()) { }
+
+template<typename T>
+TombstoneSListArray<T>::TombstoneSListArray(size_type NumberOfElements, const value_type& BaseValue) { assign(NumberOfElements, BaseValue); }
+
+template<typename T>
+TombstoneSListArray<T>::TombstoneSListArray(std::initializer_list<value_type> IL) { assign(IL); }
+
+template<typename T>
+template<std::input_iterator InputIt>
+TombstoneSListArray<T>::TombstoneSListArray(InputIt First, InputIt Last) { assign(First, Last); }
+
+template<typename T>
+TombstoneSListArray<T>::TombstoneSListArray(TombstoneSListArray<value_type>&& That) noexcept
+	: m_Data(std::move(That.m_Data)), m_Tombstones(std::move(That.m_Tombstones)),
+	  m_NumberOfTombstones(That.m_NumberOfTombstones), m_MaxTombstoneRatio(That.m_MaxTombstoneRatio)
+{
+	That.m_Data.clear();
+	That.m_Tombstones.clear();
+	That.m_NumberOfTombstones = 0;
+}
+
+
+
+template<typename T>
+auto TombstoneSListArray<T>::operator= (TombstoneSListArray<value_type> That) noexcept -> TombstoneSListArray<value_type>&
+{
+	swap(That);
+	return *this;
+}
+
+template<typename T>
+auto TombstoneSListArray<T>::operator= (std::initializer_list<value_type> IL) -> TombstoneSListArray<value_type>&
+{
+	assign(IL);
+	return *this;
+}
+
+
+
+
+template<typename T>
+void TombstoneSListArray<T>::assign(size_type NumberOfElements, const value_type& BaseValue)
+{
+	m_Data.assign(NumberOfElements, BaseValue);
+	m_Tombstones.assign((NumberOfElements + 63) / 64, 0);
+	m_NumberOfTombstones = 0;
+}
+
+template<typename T>
+void TombstoneSListArray<T>::assign(std::initializer_list<value_type> IL)
+{
+	// Just like SListArray, the values are stored in the same order they have in IL.
+	m_Data.assign(IL.begin(), IL.end());
+	m_Tombstones.assign((m_Data.size() + 63) / 64, 0);
+	m_NumberOfTombstones = 0;
+}
+
+template<typename T>
+template<std::input_iterator InputIt>
+void TombstoneSListArray<T>::assign(InputIt First, InputIt Last)
+{
+	m_Data.assign(First, Last);
+	std::reverse(m_Data.begin(), m_Data.end());
+	m_Tombstones.assign((m_Data.size() + 63) / 64, 0);
+	m_NumberOfTombstones = 0;
+}
+
+template<typename T>
+void TombstoneSListArray<T>::push_front(const value_type& Value)
+{
+	if (m_Data.size() % 64 == 0) m_Tombstones.push_back(0);
+	m_Data.push_back(Value);
+}
+
+template<typename T>
+void TombstoneSListArray<T>::pop_front()
+{
+	PopSlot();
+	PopTopTombstones();
+}
+
+template<typename T>
+auto TombstoneSListArray<T>::erase(const_iterator Position) -> iterator
+{
+	const index_type Slot = Position.index();
+
+	m_Tombstones[Slot / 64] |= const_iterator::SlotBit(Slot);
+	++m_NumberOfTombstones;
+
+	const index_type Next = (++const_iterator(m_Data.data(), m_Tombstones.data(), Slot)).index();
+	PopTopTombstones();
+
+	if (m_NumberOfTombstones <= m_MaxTombstoneRatio * m_Data.size()) return iterator(m_Data.data(), m_Tombstones.data(), Next);
+
+	// After compacting, the next element's index is the number of live slots below it.
+	size_type LiveSlotsBelowNext = 0;
+	if (Next >= 0)
+	{
+		for (index_type Word = 0; Word < Next / 64; ++Word) LiveSlotsBelowNext += 64 - std::popcount(m_Tombstones[Word]);
+		LiveSlotsBelowNext += Next % 64 - std::popcount(m_Tombstones[Next / 64] & const_iterator::SlotsBelow(Next));
+	}
+
+	compact();
+	return iterator(m_Data.data(), m_Tombstones.data(), Next >= 0 ? static_cast<index_type>(LiveSlotsBelowNext) : -1);
+}
+
+// Moves each live element down over the tombstones below it, keeping their order, then drops the freed slots from the top.
+template<typename T>
+void TombstoneSListArray<T>::compact()
+{
+	if (m_NumberOfTombstones == 0) return;
+
+	size_type Destination = 0;
+
+	for (size_type Slot = 0; Slot < m_Data.size(); ++Slot)
+	{
+		if (IsTombstone(Slot)) continue;
+
+		if (Destination != Slot) m_Data[Destination] = std::move(m_Data[Slot]);
+		++Destination;
+	}
+
+	m_Data.erase(m_Data.begin() + Destination, m_Data.end());
+	m_Tombstones.assign((m_Data.size() + 63) / 64, 0);
+	m_NumberOfTombstones = 0;
+}
+
+template<typename T>
+void TombstoneSListArray<T>::clear()
+{
+	m_Data.clear();
+	m_Tombstones.clear();
+	m_NumberOfTombstones = 0;
+}
+
+template<typename T>
+void TombstoneSListArray<T>::swap(TombstoneSListArray<value_type>& That) noexcept
+{
+	std::swap(m_Data, That.m_Data);
+	std::swap(m_Tombstones, That.m_Tombstones);
+	std::swap(m_NumberOfTombstones, That.m_NumberOfTombstones);
+	std::swap(m_MaxTombstoneRatio, That.m_MaxTombstoneRatio);
+}
+
+
+
+template<typename T>
+void TombstoneSListArray<T>::PopSlot()
+{
+	const size_type Slot = m_Data.size() - 1;
+
+	if (IsTombstone(Slot))
+	{
+		m_Tombstones[Slot / 64] &= ~const_iterator::SlotBit(Slot);
+		--m_NumberOfTombstones;
+	}
+
+	m_Data.pop_back();
+	if (m_Data.size() % 64 == 0) m_Tombstones.pop_back();
+}
+
+// Keeps the front of the list in the top slot. Each tombstone is popped at most once, so this is amortized O(1).
+template<typename T>
+void TombstoneSListArray<T>::PopTopTombstones()
+{
+	while (!m_Data.empty() && IsTombstone(m_Data.size() - 1))
+	{
+		PopSlot();
+	}
+}
+
+
+
+
+namespace std
+{
+	template<typename T>
+	void swap(TombstoneSListArray<T>& A, TombstoneSListArray<T>& B) noexcept
+	{
+		A.swap(B);
+	}
+}
@@ -0,0 +1,52 @@
+// Alessandro Pegoraro - 2022
+
+#include "AllocationCounters.h"
+
+#include <cstdlib>
+#include <new>
+
+
+namespace
+{
+	thread_local AllocationCounters::Counts t_Counts;
+
+	void* CountedAllocate(std::size_t Size)
+	{
+		// malloc(0) may return nullptr, which operator new must not.
+		void* Memory = std::malloc(Size > 0 ? Size : 1);
+		if (Memory == nullptr) throw std::bad_alloc();
+
+		++t_Counts.Allocations;
+		t_Counts.AllocatedBytes += Size;
+		return Memory;
+	}
+
+	void CountedFree(void* Memory) noexcept
+	{
+		if (Memory == nullptr) return;
+
+		++t_Counts.Deallocations;
+		std::free(Memory);
+	}
+}
+
+
+namespace AllocationCounters
+{
+	Counts ThreadCounts() noexcept
+	{
+		return t_Counts;
+	}
+}
+
+
+// The nothrow versions of the standard library forward to these ones.
+// The over-aligned versions aren't replaced: they're paired with their own operator delete, so they aren't counted.
+
+void* operator new(std::size_t Size) { return CountedAllocate(Size); }
+void* operator new[](std::size_t Size) { return CountedAllocate(Size); }
+
+void operator delete(void* Memory) noexcept { CountedFree(Memory); }
+void operator delete[](void* Memory) noexcept { CountedFree(Memory); }
+void operator delete(void* Memory, std::size_t) noexcept { CountedFree(Memory); }
+void operator delete[](void* Memory, std::size_t) noexcept { CountedFree(Memory); }
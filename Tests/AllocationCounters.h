@@ -0,0 +1,24 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * Counts the dynamic allocations made by each thread, replacing the global operator new and operator delete.
+ * The counters are thread local, so reading them costs no synchronization, and each thread only sees its own allocations.
+ */
+namespace AllocationCounters
+{
+	struct Counts
+	{
+		std::uint64_t Allocations = 0;
+		std::uint64_t Deallocations = 0;
+		std::uint64_t AllocatedBytes = 0;
+	};
+
+	// Returns the allocations made by the calling thread since it started.
+	Counts ThreadCounts() noexcept;
+}
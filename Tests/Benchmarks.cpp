@@ -0,0 +1,1470 @@
+// Alessandro Pegoraro - 2022
+
+#include "Benchmarks.h"
+#include "PerfCounters.h"
+#include "AllocationCounters.h"
+#include "LatencyHistogram.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <atomic>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <shared_mutex>
+#include <span>
+#include <thread>
+#include <vector>
+#include "SList.h"
+#include "ArenaSList.h"
+#include "CompactSList.h"
+#include "SplitSList.h"
+#include "PersistentSList.h"
+#include "RcuSList.h"
+#include "ShardedSList.h"
+#include "SListArray.h"
+#include "HugePageVector.h"
+#include "CowSListArray.h"
+#include "TombstoneSListArray.h"
+#include "ColumnarSListArray.h"
+#include "IndexedSList.h"
+#include "FixedSList.h"
+#include "FrozenSList.h"
+#include "SListViews.h"
+
+
+namespace
+{
+	struct PodPoint
+	{
+		float X, Y, Z;
+		int Id;
+	};
+
+	struct Record64
+	{
+		long long Fields[8];
+	};
+
+	struct Record256
+	{
+		int Key;
+		int Flags;
+		char Payload[248];
+	};
+
+	struct Record256Key
+	{
+		int operator() (const Record256& Record) const { return Record.Key; }
+	};
+
+	template<typename T> T MakeValue(std::size_t Seed) { return static_cast<T>(Seed); }
+	template<> PodPoint MakeValue<PodPoint>(std::size_t Seed) { float F = static_cast<float>(Seed); return { F, F, F, static_cast<int>(Seed) }; }
+	template<> Record64 MakeValue<Record64>(std::size_t Seed) { Record64 R{}; for (long long& Field : R.Fields) Field = static_cast<long long>(Seed); return R; }
+	template<> Record256 MakeValue<Record256>(std::size_t Seed) { Record256 R{}; R.Key = static_cast<int>(Seed); R.Flags = static_cast<int>(Seed % 7); return R; }
+	template<> void* MakeValue<void*>(std::size_t Seed) { return reinterpret_cast<void*>(Seed); }
+	template<> int* MakeValue<int*>(std::size_t Seed) { return reinterpret_cast<int*>(Seed * sizeof(int)); }
+
+
+	// Keeps the compiler from optimizing away the results of the measured code.
+	volatile unsigned char g_Sink = 0;
+
+	template<typename T>
+	void Consume(const T& Value)
+	{
+		unsigned char FirstByte;
+		std::memcpy(&FirstByte, &Value, 1);
+		g_Sink = g_Sink + FirstByte;
+	}
+
+
+	// Returns the average time of a single call to Function, in nanoseconds.
+	template<typename Func>
+	double MeasureNanoseconds(int Repetitions, Func&& Function)
+	{
+		const auto Start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < Repetitions; ++i) Function();
+
+		const auto End = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(End - Start).count() / Repetitions;
+	}
+
+	void PrintResult(const char* Operation, const char* TypeName, std::size_t Elements, double BaselineNs, double OptimizedNs)
+	{
+		std::cout << std::left << std::setw(28) << Operation << std::setw(10) << TypeName
+				  << std::right << std::fixed << std::setprecision(3)
+				  << std::setw(12) << BaselineNs / Elements << " ns/elem"
+				  << std::setw(12) << OptimizedNs / Elements << " ns/elem"
+				  << std::setw(9) << std::setprecision(2) << BaselineNs / OptimizedNs << "x\n";
+	}
+
+
+	template<typename T>
+	void BenchmarkSListArray(const char* TypeName, std::size_t Elements, int Repetitions)
+	{
+		SListArray<T> Source;
+		for (std::size_t i = 0; i < Elements; ++i) Source.push_front(MakeValue<T>(i));
+
+		const double ElementwiseCopy = MeasureNanoseconds(Repetitions, [&]()
+		{
+			SListArray<T> Copy;
+			for (auto It = Source.cbegin(); It != Source.cend(); ++It) Copy.push_front(*It);
+			Consume(Copy.front());
+		});
+
+		const double BulkCopy = MeasureNanoseconds(Repetitions, [&]()
+		{
+			SListArray<T> Copy(Source);
+			Consume(Copy.front());
+		});
+
+		PrintResult("SListArray copy", TypeName, Elements, ElementwiseCopy, BulkCopy);
+
+		const T BaseValue = MakeValue<T>(7);
+
+		const double ElementwiseAssign = MeasureNanoseconds(Repetitions, [&]()
+		{
+			SListArray<T> List;
+			for (std::size_t i = 0; i < Elements; ++i) List.push_front(BaseValue);
+			Consume(List.front());
+		});
+
+		const double BulkAssign = MeasureNanoseconds(Repetitions, [&]()
+		{
+			SListArray<T> List;
+			List.assign(Elements, BaseValue);
+			Consume(List.front());
+		});
+
+		PrintResult("SListArray assign(n, value)", TypeName, Elements, ElementwiseAssign, BulkAssign);
+	}
+
+	template<typename T, std::size_t Capacity>
+	void BenchmarkFixedSList(const char* TypeName, int Repetitions)
+	{
+		// Heap allocated, because a large FixedSList of 64 byte records could overflow the stack.
+		auto Source = std::make_unique<FixedSList<T, Capacity>>();
+		auto Destination = std::make_unique<FixedSList<T, Capacity>>();
+
+		for (std::size_t i = 0; i < Capacity; ++i) Source->push_front(MakeValue<T>(i));
+
+		const double ElementwiseCopy = MeasureNanoseconds(Repetitions, [&]()
+		{
+			Destination->clear();
+			for (auto It = Source->cbegin(); It != Source->cend(); ++It) Destination->push_front(*It);
+			Consume(Destination->front());
+		});
+
+		const double BulkCopy = MeasureNanoseconds(Repetitions, [&]()
+		{
+			*Destination = *Source;
+			Consume(Destination->front());
+		});
+
+		PrintResult("FixedSList operator=", TypeName, Capacity, ElementwiseCopy, BulkCopy);
+
+		const T BaseValue = MakeValue<T>(7);
+
+		const double ElementwiseAssign = MeasureNanoseconds(Repetitions, [&]()
+		{
+			Destination->clear();
+			for (std::size_t i = 0; i < Capacity; ++i) Destination->push_front(BaseValue);
+			Consume(Destination->front());
+		});
+
+		const double BulkAssign = MeasureNanoseconds(Repetitions, [&]()
+		{
+			Destination->assign(Capacity, BaseValue);
+			Consume(Destination->front());
+		});
+
+		PrintResult("FixedSList assign(n, value)", TypeName, Capacity, ElementwiseAssign, BulkAssign);
+	}
+
+	template<typename T>
+	void BenchmarkSListClear(const char* TypeName, std::size_t Elements, int Repetitions)
+	{
+		double PopFrontLoop = 0.0;
+		double Clear = 0.0;
+
+		for (int i = 0; i < Repetitions; ++i)
+		{
+			SList<T> List(Elements, MakeValue<T>(3));
+			PopFrontLoop += MeasureNanoseconds(1, [&]() { while (!List.empty()) List.pop_front(); });
+
+			SList<T> OtherList(Elements, MakeValue<T>(3));
+			Clear += MeasureNanoseconds(1, [&]() { OtherList.clear(); });
+		}
+
+		PrintResult("SList clear()", TypeName, Elements, PopFrontLoop / Repetitions, Clear / Repetitions);
+	}
+
+	template<typename T>
+	void BenchmarkArenaCopyAndClear(const char* TypeName, std::size_t Elements, int Repetitions)
+	{
+		SList<T> NodeSource(Elements, MakeValue<T>(5));
+		ArenaSList<T> ArenaSource(Elements, MakeValue<T>(5));
+
+		const double NodeCopy = MeasureNanoseconds(Repetitions, [&]()
+		{
+			SList<T> Copy(NodeSource);
+			Consume(Copy.front());
+		});
+
+		const double ArenaCopy = MeasureNanoseconds(Repetitions, [&]()
+		{
+			ArenaSList<T> Copy(ArenaSource);
+			Consume(Copy.front());
+		});
+
+		PrintResult("copy + destroy", TypeName, Elements, NodeCopy, ArenaCopy);
+
+		const double NodeTraversal = MeasureNanoseconds(Repetitions, [&]()
+		{
+			SList<T> Copy(NodeSource);
+			for (const T& Value : Copy) Consume(Value);
+		});
+
+		const double ArenaTraversal = MeasureNanoseconds(Repetitions, [&]()
+		{
+			ArenaSList<T> Copy(ArenaSource);
+			for (const T& Value : Copy) Consume(Value);
+		});
+
+		PrintResult("copy + traverse + destroy", TypeName, Elements, NodeTraversal, ArenaTraversal);
+	}
+
+	// Takes a snapshot of a list and prepends a few items to it, like a request handler would.
+	void BenchmarkSnapshot(std::size_t Elements, int Repetitions)
+	{
+		SList<int> NodeSource(Elements, 1);
+		PersistentSList<int> PersistentSource(Elements, 1);
+
+		const double NodeSnapshot = MeasureNanoseconds(Repetitions, [&]()
+		{
+			SList<int> Snapshot(NodeSource);
+			for (int i = 0; i < 4; ++i) Snapshot.push_front(i);
+			Consume(Snapshot.front());
+		});
+
+		const double PersistentSnapshot = MeasureNanoseconds(Repetitions, [&]()
+		{
+			PersistentSList<int> Snapshot(PersistentSource);
+			for (int i = 0; i < 4; ++i) Snapshot = Snapshot.push_front(i);
+			Consume(Snapshot.front());
+		});
+
+		std::cout << std::left << std::setw(12) << Elements << std::right << std::fixed << std::setprecision(1)
+				  << std::setw(16) << NodeSnapshot << " ns"
+				  << std::setw(16) << PersistentSnapshot << " ns\n";
+	}
+
+	// Each iteration copies the source and reads it: one copy out of WriteEvery also gets modified.
+	template< template<typename _> class ListType >
+	double MeasureReadersAndWriters(const ListType<int>& Source, int WriteEvery, int Repetitions)
+	{
+		int Iteration = 0;
+
+		return MeasureNanoseconds(Repetitions, [&]()
+		{
+			ListType<int> Copy(Source);
+
+			int Sum = 0;
+			const auto End = Copy.cend();
+			for (auto It = Copy.cbegin(); It != End; ++It) Sum += *It;
+			Consume(Sum);
+
+			if (WriteEvery > 0 && ++Iteration % WriteEvery == 0)
+			{
+				Copy.push_front(Sum);
+				Consume(Copy.front());
+			}
+		});
+	}
+
+	template<typename ListType>
+	double MeasureTraversal(const ListType& List, std::size_t Elements, int Repetitions)
+	{
+		return MeasureNanoseconds(Repetitions, [&]()
+		{
+			long long Sum = 0;
+			const auto End = List.cend();
+			for (auto It = List.cbegin(); It != End; ++It) Sum += static_cast<long long>(*It);
+			Consume(Sum);
+		}) / Elements;
+	}
+
+	template<typename T>
+	void BenchmarkCompactFootprint(const char* TypeName, std::size_t Elements, int Repetitions)
+	{
+		SList<T> NodeList(Elements, MakeValue<T>(1));
+		CompactSList<T> CompactList(Elements, MakeValue<T>(1));
+
+		const double NodeTraversal = MeasureTraversal(NodeList, Elements, Repetitions);
+		const double CompactTraversal = MeasureTraversal(CompactList, Elements, Repetitions);
+
+		std::cout << std::left << std::setw(10) << TypeName << std::right
+				  << std::setw(8) << sizeof(SNode<T>) << " B + alloc" << std::setw(10) << sizeof(CompactSNode<T>) << " B"
+				  << std::fixed << std::setprecision(3)
+				  << std::setw(12) << NodeTraversal << " ns/elem" << std::setw(12) << CompactTraversal << " ns/elem\n";
+	}
+
+	// Runs ReaderThreads threads calling ReadLoop, while another thread calls WriteStep every millisecond.
+	// ReadLoop runs until the flag it receives is set, returning how many traversals it completed. Returns the total traversals per second.
+	template<typename ReadLoopFunc, typename WriteStepFunc>
+	double MeasureReadThroughput(int ReaderThreads, ReadLoopFunc&& ReadLoop, WriteStepFunc&& WriteStep)
+	{
+		std::atomic<bool> Stop = false;
+		std::atomic<long long> Traversals = 0;
+		std::vector<std::thread> Threads;
+
+		const auto Start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < ReaderThreads; ++i)
+		{
+			Threads.emplace_back([&]() { Traversals += ReadLoop(Stop); });
+		}
+
+		Threads.emplace_back([&]()
+		{
+			while (!Stop.load(std::memory_order_relaxed))
+			{
+				WriteStep();
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(300));
+		Stop = true;
+		for (std::thread& Thread : Threads) Thread.join();
+
+		const auto End = std::chrono::steady_clock::now();
+		return Traversals / std::chrono::duration<double>(End - Start).count();
+	}
+
+	void BenchmarkRcuReaders(int ReaderThreads, std::size_t Elements)
+	{
+		SList<int> LockedList(Elements, 1);
+		std::shared_mutex Mutex;
+
+		const double LockedThroughput = MeasureReadThroughput(ReaderThreads, [&](const std::atomic<bool>& Stop)
+		{
+			long long Traversals = 0;
+
+			while (!Stop.load(std::memory_order_relaxed))
+			{
+				std::shared_lock<std::shared_mutex> Lock(Mutex);
+
+				int Sum = 0;
+				const auto End = LockedList.cend();
+				for (auto It = LockedList.cbegin(); It != End; ++It) Sum += *It;
+				Consume(Sum);
+				++Traversals;
+			}
+
+			return Traversals;
+		},
+		[&]()
+		{
+			std::unique_lock<std::shared_mutex> Lock(Mutex);
+			++LockedList.front();
+		});
+
+		RcuSList<int> RcuList(Elements, 1);
+
+		const double RcuThroughput = MeasureReadThroughput(ReaderThreads, [&](const std::atomic<bool>& Stop)
+		{
+			const RcuSList<int>::Reader Reader = RcuList.make_reader();
+			long long Traversals = 0;
+
+			while (!Stop.load(std::memory_order_relaxed))
+			{
+				const auto Lock = Reader.lock();
+
+				int Sum = 0;
+				const auto End = RcuList.cend();
+				for (auto It = RcuList.cbegin(); It != End; ++It) Sum += *It;
+				Consume(Sum);
+				++Traversals;
+			}
+
+			return Traversals;
+		},
+		[&]()
+		{
+			RcuList.replace_front(RcuList.front() + 1);
+		});
+
+		std::cout << std::left << std::setw(16) << ReaderThreads << std::right << std::fixed << std::setprecision(0)
+				  << std::setw(20) << LockedThroughput << " /s"
+				  << std::setw(20) << RcuThroughput << " /s"
+				  << std::setw(9) << std::setprecision(2) << RcuThroughput / LockedThroughput << "x\n";
+	}
+
+	// Returns the pushes per second of Threads threads, each one calling Push PushesPerThread times.
+	template<typename PushFunc>
+	double MeasurePushThroughput(int Threads, int PushesPerThread, PushFunc&& Push)
+	{
+		std::vector<std::thread> Pushers;
+
+		const auto Start = std::chrono::steady_clock::now();
+
+		for (int Thread = 0; Thread < Threads; ++Thread)
+		{
+			Pushers.emplace_back([&]() { for (int i = 0; i < PushesPerThread; ++i) Push(i); });
+		}
+
+		for (std::thread& Pusher : Pushers) Pusher.join();
+
+		const auto End = std::chrono::steady_clock::now();
+		return static_cast<double>(Threads) * PushesPerThread / std::chrono::duration<double>(End - Start).count();
+	}
+
+	void BenchmarkShardedPush(int Threads, int PushesPerThread)
+	{
+		SList<int> GlobalList;
+		std::mutex Mutex;
+
+		const double GlobalThroughput = MeasurePushThroughput(Threads, PushesPerThread, [&](int Value)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			GlobalList.push_front(Value);
+		});
+
+		ShardedSList<int> ShardedList(Threads);
+
+		const double ShardedThroughput = MeasurePushThroughput(Threads, PushesPerThread, [&](int Value)
+		{
+			ShardedList.push_front(Value);
+		});
+
+		Consume(GlobalList.size() + ShardedList.drain().size());
+
+		std::cout << std::left << std::setw(16) << Threads << std::right << std::fixed << std::setprecision(1)
+				  << std::setw(20) << GlobalThroughput / 1e6 << " M/s"
+				  << std::setw(20) << ShardedThroughput / 1e6 << " M/s"
+				  << std::setw(9) << std::setprecision(2) << ShardedThroughput / GlobalThroughput << "x\n";
+	}
+
+	// Fills a list one push_front() at a time, then traverses it counting the dTLB misses.
+	template<typename ListType>
+	void BenchmarkStorage(const char* Name, std::size_t Elements, int Repetitions)
+	{
+		ListType List;
+
+		const double GrowthNs = MeasureNanoseconds(1, [&]()
+		{
+			for (std::size_t i = 0; i < Elements; ++i) List.push_front(static_cast<int>(i));
+		});
+
+		PerfCounters::Counter DTLBMisses(PerfCounters::Event::DTLBLoadMisses);
+
+		DTLBMisses.Start();
+		const double TraversalNs = MeasureTraversal(List, Elements, Repetitions);
+		const long long Misses = DTLBMisses.Stop();
+
+		std::cout << std::left << std::setw(30) << Name << std::right << std::fixed << std::setprecision(1)
+				  << std::setw(12) << GrowthNs / 1e6 << " ms"
+				  << std::setw(12) << std::setprecision(3) << TraversalNs << " ns/elem";
+
+		if (Misses >= 0) std::cout << std::setw(14) << std::setprecision(5) << static_cast<double>(Misses) / (static_cast<double>(Elements) * Repetitions) << " /elem\n";
+		else std::cout << std::setw(19) << "n/a" << "\n";
+	}
+
+	// Traverses List through its const iterators, printing each hardware counter divided by the number of visited elements.
+	template<typename ListType>
+	void BenchmarkCounters(const char* Name, const ListType& List, std::size_t Elements, int Repetitions)
+	{
+		PerfCounters::CounterSet Counters;
+
+		Counters.Start();
+		const double TraversalNs = MeasureTraversal(List, Elements, Repetitions);
+		const std::array<long long, PerfCounters::NumberOfEvents> Counts = Counters.Stop();
+
+		std::cout << std::left << std::setw(14) << Name << std::right << std::fixed << std::setprecision(3) << std::setw(10) << TraversalNs;
+
+		for (long long Count : Counts)
+		{
+			if (Count >= 0) std::cout << std::setw(15) << static_cast<double>(Count) / (static_cast<double>(Elements) * Repetitions);
+			else std::cout << std::setw(15) << "n/a";
+		}
+
+		std::cout << "\n";
+	}
+
+	// Links, reverses, splices and clears two short lists of T: mostly node manipulation, with little data to move.
+	template<typename T>
+	void ExerciseSList(std::size_t Elements)
+	{
+		SList<T> A;
+		SList<T> B;
+
+		for (std::size_t i = 0; i < Elements; ++i)
+		{
+			A.push_front(MakeValue<T>(i));
+			B.push_back(MakeValue<T>(i));
+		}
+
+		A.reverse();
+		A.splice_after(A.cbegin(), std::move(B));
+		A.reverse();
+		A.pop_front();
+
+		Consume(A.front());
+		A.clear();
+	}
+
+	// Each instantiation has its own copy of the code, unless it's shared: running them one after another measures how they fit in the instruction cache.
+	template<typename... Types>
+	void ExerciseSListTypes(std::size_t Elements)
+	{
+		(ExerciseSList<Types>(Elements), ...);
+	}
+
+	// Counts and finds Searched in List, printing the memory taken by its elements next to the time per element.
+	template<typename ListType, typename CountFunc, typename FindFunc>
+	void BenchmarkScans(const char* Name, const ListType& List, std::size_t Bytes, int Repetitions, CountFunc&& Count, FindFunc&& Find)
+	{
+		const double CountNs = MeasureNanoseconds(Repetitions, [&]() { Consume(Count(List)); });
+		const double FindNs = MeasureNanoseconds(Repetitions, [&]() { Consume(Find(List)); });
+
+		std::cout << std::left << std::setw(34) << Name << std::right << std::fixed << std::setprecision(2)
+				  << std::setw(10) << static_cast<double>(Bytes) / (1024 * 1024) << " MiB"
+				  << std::setw(12) << std::setprecision(4) << CountNs / List.size() << " ns/elem"
+				  << std::setw(12) << FindNs / List.size() << " ns/elem\n";
+	}
+
+	// Sums List through its const iterators and, when it's frozen, through for_each(), next to the bytes taken by its elements.
+	template<typename ListType>
+	void BenchmarkFrozenScan(const char* Name, const ListType& List, std::size_t Bytes, int Repetitions)
+	{
+		const double IteratorNs = MeasureNanoseconds(Repetitions, [&]()
+		{
+			long long Sum = 0;
+			for (auto It = List.cbegin(); It != List.cend(); ++It) Sum += *It;
+			Consume(Sum);
+		});
+
+		std::cout << std::left << std::setw(30) << Name << std::right << std::fixed << std::setprecision(2)
+				  << std::setw(10) << static_cast<double>(Bytes) / (1024 * 1024) << " MiB"
+				  << std::setw(12) << std::setprecision(3) << IteratorNs / List.size() << " ns/elem";
+
+		if constexpr (requires { List.memory_usage(); })
+		{
+			const double ForEachNs = MeasureNanoseconds(Repetitions, [&]()
+			{
+				long long Sum = 0;
+				List.for_each([&Sum](auto Value) { Sum += Value; });
+				Consume(Sum);
+			});
+
+			std::cout << std::setw(12) << ForEachNs / List.size() << " ns/elem";
+		}
+
+		std::cout << "\n";
+	}
+
+	void PrintScanResult(const char* Name, std::size_t Elements, double Ns)
+	{
+		std::cout << std::left << std::setw(36) << Name << std::right << std::fixed << std::setprecision(3)
+				  << std::setw(10) << Ns / Elements << " ns/elem"
+				  << std::setw(10) << std::setprecision(1) << Elements / Ns * 1000.0 << " M elem/s\n";
+	}
+}
+
+
+namespace Benchmarks
+{
+	void BenchmarkBulkCopyAndAssign()
+	{
+		std::cout << "Bulk copy and assign: element by element push_front vs. bulk operations.\n\n";
+
+		constexpr std::size_t Elements = 100000;
+		constexpr int Repetitions = 50;
+
+		BenchmarkSListArray<int>("int", Elements, Repetitions);
+		BenchmarkSListArray<PodPoint>("PodPoint", Elements, Repetitions);
+		BenchmarkSListArray<Record64>("Record64", Elements, Repetitions);
+
+		BenchmarkFixedSList<int, 4096>("int", Repetitions * 20);
+		BenchmarkFixedSList<PodPoint, 4096>("PodPoint", Repetitions * 20);
+		BenchmarkFixedSList<Record64, 4096>("Record64", Repetitions * 20);
+
+		BenchmarkSListClear<int>("int", Elements, Repetitions / 5);
+		BenchmarkSListClear<PodPoint>("PodPoint", Elements, Repetitions / 5);
+		BenchmarkSListClear<Record64>("Record64", Elements, Repetitions / 5);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkArenaSList()
+	{
+		std::cout << "Arena allocation: SList vs. ArenaSList.\n\n";
+
+		constexpr std::size_t Elements = 100000;
+		constexpr int Repetitions = 20;
+
+		BenchmarkArenaCopyAndClear<int>("int", Elements, Repetitions);
+		BenchmarkArenaCopyAndClear<PodPoint>("PodPoint", Elements, Repetitions);
+		BenchmarkArenaCopyAndClear<Record64>("Record64", Elements, Repetitions);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkPersistentSnapshots()
+	{
+		std::cout << "Snapshot and push 4 items: SList vs. PersistentSList.\n\n";
+		std::cout << std::left << std::setw(12) << "Elements" << std::right << std::setw(19) << "SList" << std::setw(19) << "PersistentSList" << "\n";
+
+		BenchmarkSnapshot(1000, 2000);
+		BenchmarkSnapshot(100000, 20);
+		BenchmarkSnapshot(1000000, 3);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkCopyOnWrite()
+	{
+		std::cout << "Copy, read and sometimes write: SListArray vs. CowSListArray, 10000 elements.\n\n";
+		std::cout << std::left << std::setw(16) << "Writes" << std::right << std::setw(19) << "SListArray" << std::setw(19) << "CowSListArray" << "\n";
+
+		constexpr std::size_t Elements = 10000;
+		constexpr int Repetitions = 2000;
+
+		const SListArray<int> ArraySource(Elements, 1);
+		const CowSListArray<int> CowSource(Elements, 1);
+
+		const int WriteEveryValues[] = { 0, 100, 10, 1 };
+		const char* WriteRatioNames[] = { "none", "1%", "10%", "100%" };
+
+		for (int i = 0; i < 4; ++i)
+		{
+			const double ArrayNs = MeasureReadersAndWriters(ArraySource, WriteEveryValues[i], Repetitions);
+			const double CowNs = MeasureReadersAndWriters(CowSource, WriteEveryValues[i], Repetitions);
+
+			std::cout << std::left << std::setw(16) << WriteRatioNames[i] << std::right << std::fixed << std::setprecision(1)
+					  << std::setw(16) << ArrayNs << " ns"
+					  << std::setw(16) << CowNs << " ns\n";
+		}
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkCompactSList()
+	{
+		std::cout << "Footprint and traversal: SList vs. CompactSList, 1000000 elements.\n";
+		std::cout << "SList also pays the allocator's per node overhead, usually 8 to 16 bytes.\n\n";
+		std::cout << std::left << std::setw(10) << "Type" << std::right
+				  << std::setw(18) << "SList node" << std::setw(12) << "Compact"
+				  << std::setw(20) << "SList scan" << std::setw(20) << "Compact scan" << "\n";
+
+		constexpr std::size_t Elements = 1000000;
+		constexpr int Repetitions = 20;
+
+		BenchmarkCompactFootprint<char>("char", Elements, Repetitions);
+		BenchmarkCompactFootprint<int>("int", Elements, Repetitions);
+		BenchmarkCompactFootprint<long long>("long long", Elements, Repetitions);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkSplitSList()
+	{
+		std::cout << "Scanning 256 byte records for a key: SList vs. SplitSList, 200000 elements.\n\n";
+
+		constexpr std::size_t Elements = 200000;
+		constexpr int Repetitions = 20;
+		constexpr int SearchedKey = 0; // The first pushed record, at the end of the lists.
+
+		SList<Record256> NodeList;
+		SplitSList<Record256> SplitList;
+		SplitSList<Record256, Record256Key> HotSplitList;
+
+		for (std::size_t i = 0; i < Elements; ++i)
+		{
+			const Record256 Record = MakeValue<Record256>(i);
+			NodeList.push_front(Record);
+			SplitList.push_front(Record);
+			HotSplitList.push_front(Record);
+		}
+
+		auto HasSearchedKey = [](const Record256& Record) { return Record.Key == SearchedKey; };
+
+		PrintScanResult("SList std::find_if", Elements, MeasureNanoseconds(Repetitions, [&]()
+		{
+			Consume(std::find_if(NodeList.cbegin(), NodeList.cend(), HasSearchedKey)->Flags);
+		}));
+
+		PrintScanResult("SplitSList std::find_if", Elements, MeasureNanoseconds(Repetitions, [&]()
+		{
+			Consume(std::find_if(SplitList.cbegin(), SplitList.cend(), HasSearchedKey)->Flags);
+		}));
+
+		PrintScanResult("SplitSList nth(), links only", Elements, MeasureNanoseconds(Repetitions, [&]()
+		{
+			Consume(SplitList.nth(Elements - 1)->Flags);
+		}));
+
+		PrintScanResult("SplitSList with hot Key find_if_hot", Elements, MeasureNanoseconds(Repetitions, [&]()
+		{
+			Consume(HotSplitList.find_if_hot([](int Key) { return Key == SearchedKey; })->Flags);
+		}));
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkRcuSList()
+	{
+		std::cout << "Read throughput, traversals of 1000 elements per second: SList behind a std::shared_mutex vs. RcuSList.\n";
+		std::cout << "A writer replaces the front every millisecond. Scaling is bounded by the number of hardware threads: "
+				  << std::thread::hardware_concurrency() << ".\n\n";
+		std::cout << std::left << std::setw(16) << "Reader threads" << std::right << std::setw(23) << "shared_mutex" << std::setw(23) << "RcuSList" << "\n";
+
+		for (int ReaderThreads : { 1, 2, 4, 8 })
+		{
+			BenchmarkRcuReaders(ReaderThreads, 1000);
+		}
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkShardedSList()
+	{
+		std::cout << "Push throughput, 500000 pushes per thread: SList behind a std::mutex vs. ShardedSList with one shard per thread.\n";
+		std::cout << "Scaling is bounded by the number of hardware threads: " << std::thread::hardware_concurrency() << ".\n\n";
+		std::cout << std::left << std::setw(16) << "Threads" << std::right << std::setw(24) << "Global SList" << std::setw(24) << "ShardedSList" << "\n";
+
+		for (int Threads : { 1, 2, 4, 8 })
+		{
+			BenchmarkShardedPush(Threads, 500000);
+		}
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkHugePages()
+	{
+		std::cout << "SListArray<int> storage, 32M elements: growth through push_front(), traversal time and dTLB load misses.\n";
+		std::cout << "dTLB misses are read through perf_event_open, and reported as n/a where perf events aren't allowed.\n\n";
+		std::cout << std::left << std::setw(30) << "Storage" << std::right << std::setw(15) << "Growth" << std::setw(20) << "Traversal" << std::setw(19) << "dTLB misses" << "\n";
+
+		constexpr std::size_t Elements = 32 * 1024 * 1024;
+		constexpr int Repetitions = 5;
+
+		BenchmarkStorage<SListArray<int>>("std::vector", Elements, Repetitions);
+		BenchmarkStorage<SListArray<int, HugePageVector<int>>>("HugePageVector", Elements, Repetitions);
+		BenchmarkStorage<SListArray<int, HugePageVector<int, true>>>("HugePageVector, prefaulted", Elements, Repetitions);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkHardwareCounters()
+	{
+		constexpr std::size_t Elements = 1000000;
+		constexpr int Repetitions = 10;
+
+		std::cout << "Traversal of " << Elements << " ints through the const iterators: hardware counters per element.\n";
+
+		PerfCounters::CounterSet Probe;
+		if (!Probe.IsAnyAvailable())
+		{
+			std::cout << "Hardware counters are not available here (no perf_event_open, or perf events forbidden by the system or the container).\n";
+		}
+
+		std::cout << "\n" << std::left << std::setw(14) << "List" << std::right << std::setw(10) << "ns";
+		for (std::size_t i = 0; i < PerfCounters::NumberOfEvents; ++i) std::cout << std::setw(15) << PerfCounters::EventName(static_cast<PerfCounters::Event>(i));
+		std::cout << "\n";
+
+		const SList<int> NodeList(Elements, 1);
+		const SListArray<int> VectorList(Elements, 1);
+		// Too big for the stack.
+		const std::unique_ptr<FixedSList<int, Elements>> FixedList = std::make_unique<FixedSList<int, Elements>>(Elements, 1);
+
+		BenchmarkCounters("SList", NodeList, Elements, Repetitions);
+		BenchmarkCounters("SListArray", VectorList, Elements, Repetitions);
+		BenchmarkCounters("FixedSList", *FixedList, Elements, Repetitions);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkSListInstantiations()
+	{
+		constexpr std::size_t Elements = 16;
+		constexpr int Repetitions = 20000;
+		constexpr std::size_t NumberOfTypes = 11;
+
+		std::cout << "Push, reverse, splice and clear 2 lists of " << Elements << " elements, for each of " << NumberOfTypes << " SList instantiations in a row.\n";
+		std::cout << "Their linking code is shared through SListCore: see the instructions and L1I misses per element.\n\n";
+
+		PerfCounters::CounterSet Counters;
+
+		Counters.Start();
+		const double Ns = MeasureNanoseconds(Repetitions, []()
+		{
+			ExerciseSListTypes<char, short, int, unsigned int, long long, float, double, void*, int*, PodPoint, Record64>(Elements);
+		});
+		const std::array<long long, PerfCounters::NumberOfEvents> Counts = Counters.Stop();
+
+		const double ElementsPerRepetition = static_cast<double>(Elements) * 2 * NumberOfTypes;
+
+		std::cout << std::left << std::setw(16) << "ns" << std::right << std::fixed << std::setprecision(3) << std::setw(12) << Ns / ElementsPerRepetition << "\n";
+
+		for (std::size_t i = 0; i < PerfCounters::NumberOfEvents; ++i)
+		{
+			std::cout << std::left << std::setw(16) << PerfCounters::EventName(static_cast<PerfCounters::Event>(i)) << std::right;
+
+			if (Counts[i] >= 0) std::cout << std::setw(12) << static_cast<double>(Counts[i]) / (ElementsPerRepetition * Repetitions) << "\n";
+			else std::cout << std::setw(12) << "n/a" << "\n";
+		}
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkViews()
+	{
+		constexpr std::size_t Elements = 1000000;
+		constexpr int Repetitions = 20;
+
+		std::cout << "Filter the evens, square them and store them in a SListArray, " << Elements << " ints in a SList.\n";
+		std::cout << "Eager chaining, through temporary SLists, vs. a fused SListViews pipeline, materialized once.\n\n";
+
+		SList<int> NodeList;
+		for (std::size_t i = 0; i < Elements; ++i) NodeList.push_front(MakeValue<int>(i));
+
+		auto IsEven = [](int Value) { return Value % 2 == 0; };
+		// The values reach 999998, whose square overflows an int.
+		auto Square = [](int Value) { return static_cast<long long>(Value) * Value; };
+
+		// Each stage stores its whole result before the next one begins, so the eager chain can't stop early.
+		auto EagerChain = [&](std::size_t Taken)
+		{
+			SList<int> Evens;
+			for (int Value : NodeList) if (IsEven(Value)) Evens.push_back(Value);
+
+			SList<long long> Squares;
+			for (int Value : Evens) Squares.push_back(Square(Value));
+
+			const SListArray<long long> Result(Squares.cbegin(), std::next(Squares.cbegin(), std::min(Taken, Squares.size())));
+			Consume(Result.size());
+		};
+
+		const double EagerNs = MeasureNanoseconds(Repetitions, [&]() { EagerChain(Elements); });
+		const double FusedNs = MeasureNanoseconds(Repetitions, [&]()
+		{
+			Consume(SListViews::to<SListArray<long long>>(SListViews::all(NodeList) | SListViews::filter(IsEven) | SListViews::transform(Square)).size());
+		});
+
+		PrintResult("filter, transform", "SList", Elements, EagerNs, FusedNs);
+
+		const double EagerTakeNs = MeasureNanoseconds(Repetitions, [&]() { EagerChain(1000); });
+		const double FusedTakeNs = MeasureNanoseconds(Repetitions, [&]()
+		{
+			Consume(SListViews::to<SListArray<long long>>(SListViews::all(NodeList) | SListViews::filter(IsEven) | SListViews::transform(Square) | SListViews::take(1000)).size());
+		});
+
+		PrintResult("filter, transform, take", "SList", Elements, EagerTakeNs, FusedTakeNs);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkPackedLists()
+	{
+		constexpr std::size_t Elements = 16 * 1024 * 1024;
+		constexpr int Repetitions = 10;
+
+		std::cout << "Count and find on " << Elements << " flags and 2 bit codes: one byte per element with the std algorithms vs. packed word at a time kernels.\n";
+		std::cout << "The searched value is only at the back of the lists, so find() scans all of them.\n\n";
+		std::cout << std::left << std::setw(34) << "List" << std::right << std::setw(14) << "Memory" << std::setw(20) << "count" << std::setw(20) << "find" << "\n";
+
+		enum class Code : unsigned char { A, B, C, D };
+
+		SListArray<unsigned char> ByteFlags;
+		SListArray<bool> PackedFlags;
+		SListArray<Code> ByteCodes;
+		PackedSListArray<Code, 2> PackedCodes;
+
+		for (std::size_t i = 0; i < Elements; ++i)
+		{
+			const bool Flag = i == 0;
+			const Code Value = i == 0 ? Code::D : static_cast<Code>(i % 3);
+
+			ByteFlags.push_front(Flag);
+			PackedFlags.push_front(Flag);
+			ByteCodes.push_front(Value);
+			PackedCodes.push_front(Value);
+		}
+
+		BenchmarkScans("SListArray<unsigned char>, std", ByteFlags, Elements, Repetitions,
+			[](const auto& List) { return std::count(List.cbegin(), List.cend(), 1); },
+			[](const auto& List) { return *std::find(List.cbegin(), List.cend(), 1); });
+
+		BenchmarkScans("SListArray<bool>, packed", PackedFlags, Elements / 8, Repetitions,
+			[](const auto& List) { return List.count(true); },
+			[](const auto& List) { return *List.find(true); });
+
+		BenchmarkScans("SListArray<Code>, std", ByteCodes, Elements, Repetitions,
+			[](const auto& List) { return std::count(List.cbegin(), List.cend(), Code::D); },
+			[](const auto& List) { return *std::find(List.cbegin(), List.cend(), Code::D); });
+
+		BenchmarkScans("PackedSListArray<Code, 2>", PackedCodes, Elements / 4, Repetitions,
+			[](const auto& List) { return List.count(Code::D); },
+			[](const auto& List) { return *List.find(Code::D); });
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkFrozenSList()
+	{
+		constexpr std::size_t Elements = 16 * 1024 * 1024;
+		constexpr int Repetitions = 10;
+
+		std::cout << "Memory and sequential sum of " << Elements << " elements: SListArray vs. FrozenSList, through the iterators and for_each().\n\n";
+		std::cout << std::left << std::setw(30) << "List" << std::right << std::setw(14) << "Memory" << std::setw(20) << "Iterators" << std::setw(20) << "for_each" << "\n";
+
+		SListArray<long long> Timestamps;
+		SListArray<int> Counters;
+		SListArray<int> Random;
+
+		long long Timestamp = 1650000000000;
+		for (std::size_t i = 0; i < Elements; ++i)
+		{
+			Timestamp += static_cast<long long>(i * 2654435761u % 1000);
+			Timestamps.push_front(Timestamp);
+			Counters.push_front(static_cast<int>(i % 100));
+			Random.push_front(static_cast<int>(i * 2654435761u));
+		}
+
+		const FrozenSList<long long> FrozenTimestamps = freeze(Timestamps);
+		const FrozenSList<int> FrozenCounters = freeze(Counters);
+		const FrozenSList<int> FrozenRandom = freeze(Random);
+
+		BenchmarkFrozenScan("SListArray<long long>, times", Timestamps, Elements * sizeof(long long), Repetitions);
+		BenchmarkFrozenScan("FrozenSList<long long>, times", FrozenTimestamps, FrozenTimestamps.memory_usage(), Repetitions);
+		BenchmarkFrozenScan("SListArray<int>, counters", Counters, Elements * sizeof(int), Repetitions);
+		BenchmarkFrozenScan("FrozenSList<int>, counters", FrozenCounters, FrozenCounters.memory_usage(), Repetitions);
+		BenchmarkFrozenScan("SListArray<int>, random", Random, Elements * sizeof(int), Repetitions);
+		BenchmarkFrozenScan("FrozenSList<int>, random", FrozenRandom, FrozenRandom.memory_usage(), Repetitions);
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkTombstoneErase()
+	{
+		constexpr std::size_t Elements = 200000;
+		constexpr std::size_t Stride = 50;
+		constexpr int Repetitions = 5;
+
+		std::cout << "Erasing every " << Stride << "th element of " << Elements << " ints while walking the list, then scanning it:\n";
+		std::cout << "std::vector::erase, shifting the following elements, vs. TombstoneSListArray::erase, with the default and without compaction.\n\n";
+		std::cout << std::left << std::setw(36) << "List" << std::right << std::setw(20) << "Erase" << std::setw(20) << "Scan" << "\n";
+
+		auto PrintRow = [](const char* Name, double EraseNs, double ScanNs)
+		{
+			std::cout << std::left << std::setw(36) << Name << std::right << std::fixed << std::setprecision(1)
+					  << std::setw(14) << EraseNs / (Elements / Stride) << " ns/op"
+					  << std::setw(14) << std::setprecision(3) << ScanNs / Elements << " ns/elem\n";
+		};
+
+		// Each repetition erases from a fresh copy, which is made outside of the measured time.
+		auto MeasureErase = [&](auto& Copies, auto&& EraseAll)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			for (auto& Copy : Copies) EraseAll(Copy);
+			return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / Repetitions;
+		};
+
+		std::vector<std::vector<int>> Vectors(Repetitions, std::vector<int>(Elements, 1));
+		const double VectorEraseNs = MeasureErase(Vectors, [](std::vector<int>& Vector)
+		{
+			std::size_t Position = 0;
+			for (auto It = Vector.begin(); It != Vector.end(); ++Position)
+			{
+				if (Position % Stride == 0) It = Vector.erase(It);
+				else ++It;
+			}
+		});
+
+		PrintRow("std::vector", VectorEraseNs, MeasureNanoseconds(Repetitions, [&]()
+		{
+			long long Sum = 0;
+			for (int Value : Vectors[0]) Sum += Value;
+			Consume(Sum);
+		}));
+
+		for (double Ratio : { TombstoneSListArray<int>::DefaultMaxTombstoneRatio, 1.0 })
+		{
+			std::vector<TombstoneSListArray<int>> Lists(Repetitions, TombstoneSListArray<int>(Elements, 1));
+			for (TombstoneSListArray<int>& List : Lists) List.set_max_tombstone_ratio(Ratio);
+
+			const double EraseNs = MeasureErase(Lists, [](TombstoneSListArray<int>& List)
+			{
+				std::size_t Position = 0;
+				for (auto It = List.begin(); It != List.end(); ++Position)
+				{
+					if (Position % Stride == 0) It = List.erase(It);
+					else ++It;
+				}
+			});
+
+			const double ScanNs = MeasureNanoseconds(Repetitions, [&]()
+			{
+				long long Sum = 0;
+				for (int Value : Lists[0]) Sum += Value;
+				Consume(Sum);
+			});
+
+			PrintRow(Ratio < 1.0 ? "TombstoneSListArray, ratio 0.25" : "TombstoneSListArray, never compacted", EraseNs, ScanNs);
+		}
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkIndexedSList()
+	{
+		std::cout << "Looking up random keys, half of them missing, and erasing random keys in the list: a linear std::find_if over SList vs. IndexedSList's hash index.\n\n";
+		std::cout << std::left << std::setw(12) << "Elements" << std::setw(12) << "Operation"
+				  << std::right << std::setw(20) << "SList" << std::setw(20) << "IndexedSList" << std::setw(12) << "Speedup" << "\n";
+
+		for (std::size_t Elements : { std::size_t(1000), std::size_t(100000), std::size_t(10000000) })
+		{
+			// The linear walks take O(n) each, so the bigger lists get fewer of them.
+			const std::size_t LinearQueries = std::max<std::size_t>(5, 10000000 / Elements / 10);
+			constexpr std::size_t IndexedQueries = 100000;
+
+			std::vector<int> Keys(Elements);
+			for (std::size_t i = 0; i < Elements; ++i) Keys[i] = static_cast<int>(i);
+
+			std::mt19937 Random(42);
+			std::shuffle(Keys.begin(), Keys.end(), Random);
+
+			SList<int> Linear(Keys.cbegin(), Keys.cend());
+			IndexedSList<int> Indexed(Keys.cbegin(), Keys.cend());
+
+			std::vector<int> Queries(IndexedQueries);
+			for (int& Query : Queries) Query = static_cast<int>(Random() % (2 * Elements));
+
+			auto PrintRow = [&](const char* Operation, double LinearNs, double IndexedNs)
+			{
+				std::cout << std::left << std::setw(12) << Elements << std::setw(12) << Operation
+						  << std::right << std::fixed << std::setprecision(1)
+						  << std::setw(14) << LinearNs << " ns/op" << std::setw(14) << IndexedNs << " ns/op"
+						  << std::setw(11) << std::setprecision(0) << LinearNs / IndexedNs << "x\n";
+			};
+
+			const double LinearFindNs = MeasureNanoseconds(1, [&]()
+			{
+				std::size_t Found = 0;
+				for (std::size_t i = 0; i < LinearQueries; ++i)
+				{
+					const int Key = Queries[i];
+					Found += std::find_if(Linear.cbegin(), Linear.cend(), [Key](int Value) { return Value == Key; }) != Linear.cend();
+				}
+				Consume(Found);
+			}) / LinearQueries;
+
+			const double IndexedFindNs = MeasureNanoseconds(1, [&]()
+			{
+				std::size_t Found = 0;
+				for (int Key : Queries) Found += Indexed.contains(Key);
+				Consume(Found);
+			}) / IndexedQueries;
+
+			PrintRow("contains", LinearFindNs, IndexedFindNs);
+
+			// Only keys in the lists are erased, each one once, in a different order than the one of the lists.
+			// The linear walk keeps the predecessor, to unlink the node with erase_after().
+			std::shuffle(Keys.begin(), Keys.end(), Random);
+			const std::vector<int> Erased(Keys.cbegin(), Keys.cbegin() + std::min(Elements / 2, IndexedQueries));
+			const std::size_t LinearErases = std::min(LinearQueries, Erased.size());
+
+			const double LinearEraseNs = MeasureNanoseconds(1, [&]()
+			{
+				for (std::size_t i = 0; i < LinearErases; ++i)
+				{
+					if (Linear.front() == Erased[i]) { Linear.pop_front(); continue; }
+
+					auto Predecessor = Linear.cbegin();
+					while (*std::next(Predecessor) != Erased[i]) ++Predecessor;
+					Linear.erase_after(Predecessor);
+				}
+			}) / LinearErases;
+
+			const double IndexedEraseNs = MeasureNanoseconds(1, [&]()
+			{
+				for (int Key : Erased) Indexed.erase(Key);
+			}) / Erased.size();
+
+			PrintRow("erase", LinearEraseNs, IndexedEraseNs);
+		}
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkMerge()
+	{
+		constexpr std::size_t Elements = 1000000;
+
+		std::cout << "Merging k sorted lists of " << Elements << " random ints overall: one by one, pairwise, vs. all at once through a LoserTree.\n";
+		std::cout << "SListArray's k-way merge is also split among threads; std::thread::hardware_concurrency() is " << std::thread::hardware_concurrency() << ".\n\n";
+		std::cout << std::left << std::setw(8) << "k" << std::setw(28) << "List"
+				  << std::right << std::setw(18) << "Pairwise" << std::setw(18) << "k-way" << std::setw(10) << "Speedup" << "\n";
+
+		// Fresh lists for each measurement, since merging empties them: they're built outside of the measured time.
+		auto MakeLists = [](auto Lists, std::size_t k)
+		{
+			std::mt19937 Random(static_cast<unsigned int>(k));
+			Lists.resize(k);
+
+			for (auto& List : Lists)
+			{
+				std::vector<int> Values(Elements / k);
+				for (int& Value : Values) Value = static_cast<int>(Random());
+				std::sort(Values.begin(), Values.end());
+				List.assign(Values.cbegin(), Values.cend());
+			}
+
+			return Lists;
+		};
+
+		auto PrintRow = [](std::size_t k, const char* Name, double PairwiseNs, double KWayNs)
+		{
+			std::cout << std::left << std::setw(8) << k << std::setw(28) << Name << std::right << std::fixed << std::setprecision(2)
+					  << std::setw(12) << PairwiseNs / Elements << " ns/el" << std::setw(12) << KWayNs / Elements << " ns/el"
+					  << std::setw(9) << std::setprecision(1) << PairwiseNs / KWayNs << "x\n";
+		};
+
+		auto MeasureMerges = [&](std::size_t k, const char* Name, auto Empty, auto&& MergeAll)
+		{
+			auto Lists = MakeLists(Empty, k);
+			const double PairwiseNs = MeasureNanoseconds(1, [&]()
+			{
+				for (std::size_t i = 1; i < k; ++i) Lists[0].merge(std::move(Lists[i]));
+				Consume(Lists[0].front());
+			});
+
+			Lists = MakeLists(Empty, k);
+			const double KWayNs = MeasureNanoseconds(1, [&]()
+			{
+				MergeAll(Lists);
+				Consume(Lists[0].front());
+			});
+
+			PrintRow(k, Name, PairwiseNs, KWayNs);
+		};
+
+		for (std::size_t k : { std::size_t(4), std::size_t(32), std::size_t(256) })
+		{
+			MeasureMerges(k, "SList", std::vector<SList<int>>(), [](std::vector<SList<int>>& Lists)
+			{
+				Lists[0].merge(std::span<SList<int>>(Lists).subspan(1));
+			});
+
+			MeasureMerges(k, "SListArray, 1 thread", std::vector<SListArray<int>>(), [](std::vector<SListArray<int>>& Lists)
+			{
+				Lists[0].merge(std::span<SListArray<int>>(Lists).subspan(1), std::less<int>(), 1);
+			});
+		}
+
+		std::cout << "\nScaling SListArray's k-way merge with the number of threads, k = 256:\n";
+
+		double SingleThreadNs = 0;
+		for (unsigned int Threads : { 1u, 2u, 4u, 8u })
+		{
+			auto Lists = MakeLists(std::vector<SListArray<int>>(), 256);
+			const double Ns = MeasureNanoseconds(1, [&]()
+			{
+				Lists[0].merge(std::span<SListArray<int>>(Lists).subspan(1), std::less<int>(), Threads);
+				Consume(Lists[0].front());
+			});
+
+			if (Threads == 1) SingleThreadNs = Ns;
+			std::cout << std::setw(4) << Threads << " threads" << std::fixed << std::setprecision(2) << std::setw(12) << Ns / Elements << " ns/el"
+					  << std::setw(9) << std::setprecision(1) << SingleThreadNs / Ns << "x\n";
+		}
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkBatchPushPop()
+	{
+		constexpr std::size_t Bursts = 2000;
+		constexpr std::size_t BurstSize = 1000;
+
+		std::cout << "Pushing " << Bursts << " bursts of " << BurstSize << " ints to the front, then draining them in bursts into a buffer:\n";
+		std::cout << "a push_front() or pop_front() call per element vs. push_front_range() and pop_front_n().\n\n";
+		std::cout << std::left << std::setw(14) << "List" << std::setw(8) << "Burst"
+				  << std::right << std::setw(20) << "Per element" << std::setw(20) << "Batched" << std::setw(10) << "Speedup" << "\n";
+
+		std::vector<int> Burst(BurstSize);
+		for (std::size_t i = 0; i < BurstSize; ++i) Burst[i] = static_cast<int>(i);
+
+		auto PrintRow = [](const char* Name, const char* Operation, double PerElementNs, double BatchedNs)
+		{
+			constexpr double Elements = static_cast<double>(Bursts * BurstSize);
+
+			std::cout << std::left << std::setw(14) << Name << std::setw(8) << Operation << std::right << std::fixed << std::setprecision(2)
+					  << std::setw(14) << PerElementNs / Elements << " ns/el" << std::setw(14) << BatchedNs / Elements << " ns/el"
+					  << std::setw(9) << std::setprecision(1) << PerElementNs / BatchedNs << "x\n";
+		};
+
+		auto MeasureList = [&](const char* Name, auto List)
+		{
+			// Both drain each burst into the same preallocated buffer, so that only the lists' work is measured.
+			std::vector<int> Drained(BurstSize);
+
+			// A first untimed round, so that neither side pays for faulting in the pages of the heap.
+			for (std::size_t b = 0; b < Bursts; ++b) List.push_front_range(Burst.cbegin(), Burst.cend());
+			List.clear();
+
+			const double PushNs = MeasureNanoseconds(1, [&]()
+			{
+				for (std::size_t b = 0; b < Bursts; ++b)
+				{
+					for (auto It = Burst.crbegin(); It != Burst.crend(); ++It) List.push_front(*It);
+				}
+			});
+
+			const double PopNs = MeasureNanoseconds(1, [&]()
+			{
+				while (!List.empty())
+				{
+					for (std::size_t i = 0; i < BurstSize; ++i)
+					{
+						Drained[i] = List.front();
+						List.pop_front();
+					}
+					Consume(Drained.back());
+				}
+			});
+
+			const double PushRangeNs = MeasureNanoseconds(1, [&]()
+			{
+				for (std::size_t b = 0; b < Bursts; ++b) List.push_front_range(Burst.cbegin(), Burst.cend());
+			});
+
+			const double PopNNs = MeasureNanoseconds(1, [&]()
+			{
+				while (!List.empty())
+				{
+					List.pop_front_n(BurstSize, Drained.begin());
+					Consume(Drained.back());
+				}
+			});
+
+			PrintRow(Name, "push", PushNs, PushRangeNs);
+			PrintRow(Name, "pop", PopNs, PopNNs);
+		};
+
+		MeasureList("SList", SList<int>());
+		MeasureList("SListArray", SListArray<int>());
+		MeasureList("HugePage", SListArray<int, HugePageVector<int>>());
+
+		// Detaching the bursts as lists of their own moves no value and frees no node, it only walks each burst to find its last node.
+		// The detached lists are destroyed outside of the measured time.
+		SList<int> Nodes;
+		for (std::size_t b = 0; b < Bursts; ++b) Nodes.push_front_range(Burst.cbegin(), Burst.cend());
+
+		std::vector<SList<int>> Detached;
+		Detached.reserve(Bursts);
+
+		const double DetachNs = MeasureNanoseconds(1, [&]()
+		{
+			while (!Nodes.empty()) Detached.push_back(Nodes.pop_front_n(BurstSize));
+		});
+
+		std::cout << std::left << std::setw(22) << "SList, detached" << std::right << std::setw(34) << std::fixed << std::setprecision(2)
+				  << DetachNs / (Bursts * BurstSize) << " ns/el\n\n";
+	}
+
+	void BenchmarkColumnar()
+	{
+		constexpr std::size_t Elements = 1000000;
+		constexpr int Reps = 20;
+
+		// 48 bytes per record, of which the scans only read the 4 of Price.
+		struct Record
+		{
+			long long Id;
+			double Weight;
+			double Volume;
+			double Cost;
+			long long Stock;
+			float Price;
+			int Category;
+		};
+
+		std::cout << "Summing the Price field of " << Elements << " records of " << sizeof(Record) << " bytes:\n";
+		std::cout << "a SListArray of structs vs. a ColumnarSListArray, through its iterators and through the Price column alone.\n\n";
+
+		SListArray<Record> Rows;
+		ColumnarSListArray<long long, double, double, double, long long, float, int> Columns;
+		Columns.reserve(Elements);
+
+		std::mt19937 Random(7);
+		for (std::size_t i = 0; i < Elements; ++i)
+		{
+			const Record Row{ static_cast<long long>(i), 1.0, 2.0, 3.0, 4, static_cast<float>(Random() % 100), static_cast<int>(i % 16) };
+			Rows.push_front(Row);
+			Columns.push_front(Row.Id, Row.Weight, Row.Volume, Row.Cost, Row.Stock, Row.Price, Row.Category);
+		}
+
+		const double RowsNs = MeasureNanoseconds(Reps, [&]()
+		{
+			float Sum = 0;
+			for (const Record& Row : Rows) Sum += Row.Price;
+			Consume(Sum);
+		});
+
+		const double ProxyNs = MeasureNanoseconds(Reps, [&]()
+		{
+			float Sum = 0;
+			for (auto It = Columns.cbegin(); It != Columns.cend(); ++It) Sum += It.get<5>();
+			Consume(Sum);
+		});
+
+		const double ColumnNs = MeasureNanoseconds(Reps, [&]()
+		{
+			const auto Prices = Columns.column<5>();
+			Consume(std::accumulate(Prices.begin(), Prices.end(), 0.0f));
+		});
+
+		auto PrintRow = [RowsNs](const char* Name, double Ns)
+		{
+			std::cout << std::left << std::setw(36) << Name << std::right << std::fixed << std::setprecision(3)
+					  << std::setw(10) << Ns / Elements << " ns/el" << std::setw(9) << std::setprecision(1) << RowsNs / Ns << "x\n";
+		};
+
+		PrintRow("SListArray<Record>", RowsNs);
+		PrintRow("ColumnarSListArray, iterators", ProxyNs);
+		PrintRow("ColumnarSListArray, column span", ColumnNs);
+		std::cout << "\n";
+	}
+
+	void BenchmarkTailLatency(unsigned int Threads)
+	{
+		constexpr std::size_t Rounds = 20;
+		constexpr std::size_t PushesPerRound = 100000;
+		constexpr std::size_t ClearEvery = 5;
+
+		// Each round pushes PushesPerRound ints, then pops half of them: the lists grow by half a round each round, until they're cleared.
+		constexpr std::size_t MaxElements = (ClearEvery - 1) * PushesPerRound / 2 + PushesPerRound;
+
+		enum Operation { Push, Pop, Clear, NumberOfOperations };
+		const char* const OperationNames[NumberOfOperations] = { "push", "pop", "clear" };
+
+		std::cout << "Latency distribution of every single operation, with " << Threads << " threads each growing a list of its own to "
+				  << MaxElements << " ints and clearing it, " << Rounds / ClearEvery << " times.\n";
+		std::cout << "The threads share the allocator, and std::thread::hardware_concurrency() is " << std::thread::hardware_concurrency() << ".\n";
+		std::cout << "The last columns sum the operations at or above p99.9, along with the allocations and deallocations they made.\n\n";
+		std::cout << std::left << std::setw(17) << "List" << std::setw(7) << "Op" << std::right << std::setw(10) << "Ops"
+				  << std::setw(9) << "p50 ns" << std::setw(9) << "p99 ns" << std::setw(11) << "p99.9 ns" << std::setw(12) << "max ns"
+				  << std::setw(10) << ">= p99.9" << std::setw(9) << "allocs" << std::setw(9) << "frees" << "\n";
+
+		// The clock is read around each operation, along with the thread's allocation counters.
+		auto Timed = [](LatencyHistogram& Histogram, auto&& Function)
+		{
+			const AllocationCounters::Counts Before = AllocationCounters::ThreadCounts();
+			const auto Start = std::chrono::steady_clock::now();
+
+			Function();
+
+			const auto End = std::chrono::steady_clock::now();
+			const AllocationCounters::Counts After = AllocationCounters::ThreadCounts();
+
+			Histogram.Record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Start).count()),
+							 After.Allocations - Before.Allocations, After.Deallocations - Before.Deallocations);
+		};
+
+		auto MeasureList = [&](const char* Name, auto MakeList)
+		{
+			std::vector<std::array<LatencyHistogram, NumberOfOperations>> Histograms(Threads);
+			std::vector<std::thread> Workers;
+			std::latch Ready(Threads);
+
+			for (unsigned int t = 0; t < Threads; ++t)
+			{
+				Workers.emplace_back([&, t]()
+				{
+					auto List = MakeList();
+					auto& Histogram = Histograms[t];
+
+					// Every thread starts loading the allocator at the same time.
+					Ready.arrive_and_wait();
+
+					for (std::size_t Round = 1; Round <= Rounds; ++Round)
+					{
+						for (std::size_t i = 0; i < PushesPerRound; ++i) Timed(Histogram[Push], [&]() { List->push_front(static_cast<int>(i)); });
+						for (std::size_t i = 0; i < PushesPerRound / 2; ++i) Timed(Histogram[Pop], [&]() { List->pop_front(); });
+
+						if (Round % ClearEvery == 0) Timed(Histogram[Clear], [&]() { List->clear(); });
+					}
+				});
+			}
+
+			for (std::thread& Worker : Workers) Worker.join();
+			SListReclaimer::Instance().Flush();
+
+			for (int Op = Push; Op < NumberOfOperations; ++Op)
+			{
+				LatencyHistogram Merged;
+				for (const auto& Histogram : Histograms) Merged.Merge(Histogram[Op]);
+
+				const std::uint64_t P999 = Merged.ValueAtPercentile(99.9);
+				const LatencyHistogram::Tail Outliers = Merged.TailFrom(P999);
+
+				std::cout << std::left << std::setw(17) << Name << std::setw(7) << OperationNames[Op] << std::right << std::setw(10) << Merged.Count()
+						  << std::setw(9) << Merged.ValueAtPercentile(50.0) << std::setw(9) << Merged.ValueAtPercentile(99.0)
+						  << std::setw(11) << P999 << std::setw(12) << Merged.Max()
+						  << std::setw(10) << Outliers.Operations << std::setw(9) << Outliers.Allocations << std::setw(9) << Outliers.Deallocations << "\n";
+			}
+		};
+
+		// Every list is created by its own thread, on the heap: a FixedSList this big wouldn't fit in a thread's stack.
+		MeasureList("SList", []() { return std::make_unique<SList<int>>(); });
+		MeasureList("SList, deferred", []()
+		{
+			auto List = std::make_unique<SList<int>>();
+			List->set_deferred_destruction(true);
+			return List;
+		});
+		MeasureList("SListArray", []() { return std::make_unique<SListArray<int>>(); });
+		MeasureList("FixedSList", []() { return std::make_unique<FixedSList<int, MaxElements>>(); });
+
+		std::cout << "\n";
+	}
+
+	void BenchmarkDeferredDestruction()
+	{
+		std::cout << "Time taken by clear() to return, for a SList of ints: freeing every node, or handing them to the SListReclaimer,\n";
+		std::cout << "along with the time its background thread takes to destroy them, waited for through Flush().\n\n";
+		std::cout << std::right << std::setw(10) << "Nodes" << std::setw(16) << "Synchronous" << std::setw(16) << "Deferred" << std::setw(16) << "Flush" << "\n";
+
+		for (std::size_t Elements : { std::size_t(10000), std::size_t(1000000), std::size_t(10000000) })
+		{
+			SList<int> List;
+			List.push_front_n(Elements, 1);
+
+			const double SynchronousNs = MeasureNanoseconds(1, [&]() { List.clear(); });
+
+			List.push_front_n(Elements, 1);
+			List.set_deferred_destruction(true);
+
+			const double DeferredNs = MeasureNanoseconds(1, [&]() { List.clear(); });
+			const double FlushNs = MeasureNanoseconds(1, []() { SListReclaimer::Instance().Flush(); });
+
+			std::cout << std::setw(10) << Elements << std::fixed << std::setprecision(3)
+					  << std::setw(13) << SynchronousNs / 1e6 << " ms" << std::setw(13) << DeferredNs / 1e6 << " ms" << std::setw(13) << FlushNs / 1e6 << " ms\n";
+		}
+
+		std::cout << "\n";
+	}
+}
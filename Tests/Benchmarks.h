@@ -0,0 +1,35 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+
+/**
+ * Micro benchmarks for the 3 list types.
+ * They are not executed by default: run the application with the --bench argument.
+ */
+namespace Benchmarks
+{
+	void BenchmarkBulkCopyAndAssign();
+	void BenchmarkArenaSList();
+	void BenchmarkPersistentSnapshots();
+	void BenchmarkCopyOnWrite();
+	void BenchmarkCompactSList();
+	void BenchmarkSplitSList();
+	void BenchmarkRcuSList();
+	void BenchmarkShardedSList();
+	void BenchmarkHugePages();
+	void BenchmarkHardwareCounters();
+	void BenchmarkSListInstantiations();
+	void BenchmarkViews();
+	void BenchmarkPackedLists();
+	void BenchmarkFrozenSList();
+	void BenchmarkTombstoneErase();
+	void BenchmarkIndexedSList();
+	void BenchmarkMerge();
+	void BenchmarkBatchPushPop();
+	void BenchmarkColumnar();
+	void BenchmarkDeferredDestruction();
+
+	// Run on their own, through the --latency argument: Threads defaults to the number of hardware threads.
+	void BenchmarkTailLatency(unsigned int Threads);
+}
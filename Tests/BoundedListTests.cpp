@@ -0,0 +1,136 @@
+// Alessandro Pegoraro - 2022
+
+#include "BoundedListTests.h"
+#include <iostream>
+#include "BoundedSList.h"
+
+
+namespace
+{
+	template<typename T>
+	void PrintList(const BoundedSList<T>& List)
+	{
+		int count = 0;
+
+		for (auto It = List.cbegin(); It != List.cend(); ++It)
+		{
+			++count;
+			std::cout << *It << " ";
+		}
+
+		std::cout << "Number Of Elements: " << count << ", size(): " << List.size() << ", capacity(): " << List.capacity() << "\n";
+	}
+
+	BoundedSList<int> ReturnListOfIntegers() { return BoundedSList<int>(BoundedCapacity{ 4 }, 1, 8); }
+}
+
+
+namespace BoundedTests
+{
+	void TestPushPopClearAndFront()
+	{
+		BoundedSList<int> ForwardList(BoundedCapacity{ 3 });
+
+		PrintList(ForwardList);
+		std::cout << "Is empty? " << (ForwardList.empty() ? "Yep\n\n" : "Nope\n\n");
+
+		ForwardList.push_front(5);
+		ForwardList.push_front(6);
+		ForwardList.push_front(7);
+		ForwardList.push_front(8); // Exceeds the capacity, so it's discarded.
+
+		PrintList(ForwardList);
+		std::cout << "Is empty? " << (ForwardList.empty() ? "Yep\n\n" : "Nope\n\n");
+
+		ForwardList.pop_front();
+		PrintList(ForwardList);
+		ForwardList.push_front(1);
+		PrintList(ForwardList);
+
+		std::cout << "\nFront: " << ForwardList.front() << ", now clearing.\n";
+
+		ForwardList.clear();
+		PrintList(ForwardList);
+
+		std::cout << "\n";
+	}
+
+	void TestConstructors()
+	{
+		BoundedSList<int> FirstForwardList(BoundedCapacity{ 10 }, 6);
+		PrintList(FirstForwardList); std::cout << "\n";
+
+		BoundedSList<float> SecondForwardList(BoundedCapacity{ 10 }, 5, 3.f);
+		PrintList(SecondForwardList); std::cout << "\n";
+
+		BoundedSList<float> ThirdForwardList(SecondForwardList);
+		PrintList(ThirdForwardList); std::cout << "\n";
+
+		// Without a BoundedCapacity, the arguments mean the same as FixedSList's: three 4s, in a list of DefaultCapacity.
+		BoundedSList<int> FourthForwardList(3, 4);
+		PrintList(FourthForwardList); std::cout << "\n";
+
+		// A capacity that would overflow the stack as a FixedSList.
+		BoundedSList<int> BigList(BoundedCapacity{ 10000000 }, 10000000, 1);
+		std::cout << "Big list size(): " << BigList.size() << ", capacity(): " << BigList.capacity() << "\n\n";
+	}
+
+	void TestSwap()
+	{
+		BoundedSList<int> ListA(BoundedCapacity{ 3 }, 3, 2);
+		BoundedSList<int> ListB(BoundedCapacity{ 20 }); ListB.push_front(6); ListB.push_front(3);
+
+		ListA.swap(ListB);
+
+		std::cout << "Printing List A...\n";
+		PrintList(ListA);
+		std::cout << "\nPrinting List B...\n";
+		PrintList(ListB);
+
+		std::swap(ListB, ListA);
+
+		std::cout << "\nAgain, Printing List A...\n";
+		PrintList(ListA);
+		std::cout << "\nPrinting List B...\n";
+		PrintList(ListB);
+	}
+
+	void TestAssignment()
+	{
+		BoundedSList<int> A(BoundedCapacity{ 5 }, 5, 2);
+		PrintList(A);
+
+		A.assign(2, 7);
+		std::cout << "\nPrinting after assign(2, 7)...\n";
+		PrintList(A);
+
+		A.assign(9, 7);
+		std::cout << "\nPrinting after assign(9, 7), exceeding the capacity...\n";
+		PrintList(A);
+
+		BoundedSList<int> B(BoundedCapacity{ 3 }, 3, 4);
+		std::cout << "\n\nList B...\n";
+		PrintList(B);
+
+		B = A;
+		std::cout << "\nB = A\n";
+		PrintList(B);
+
+		A = ReturnListOfIntegers();
+		std::cout << "\nA = some temp\n";
+		PrintList(A);
+	}
+
+	// Just like FixedSList, the front of the list is the last element of the initializer list.
+	void TestInitializationList()
+	{
+		BoundedSList<float> A = { 1.f, 8.f, 8.96f, 2.364f, 3.14f };
+		PrintList(A);
+
+		BoundedSList<int> B(BoundedCapacity{ 2 });
+		PrintList(B = { 3, 6, 5 });
+
+		A.assign({ 5.65f, 3.85f });
+		PrintList(A);
+	}
+}
@@ -0,0 +1,13 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+
+namespace BoundedTests
+{
+	void TestPushPopClearAndFront();
+	void TestConstructors();
+	void TestSwap();
+	void TestAssignment();
+	void TestInitializationList();
+}
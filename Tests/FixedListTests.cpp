@@ -7,8 +7,8 @@
 
 namespace
 {
-	template<typename T>
-	void PrintList(const FixedSList<T>& List)
+	template<typename T, std::size_t Capacity>
+	void PrintList(const FixedSList<T, Capacity>& List)
 	{
 		int count = 0;
 
@@ -18,10 +18,49 @@ namespace
 			std::cout << *It << " ";
 		}
 
-		std::cout << "Number Of Elements: " << count << "\n";
+		std::cout << "Number Of Elements: " << count << ", size(): " << List.size() << "\n";
 	}
 
 	FixedSList<int> ReturnListOfIntegers() { return FixedSList<int>(1, 8); }
+
+	// Builds a table of the first 10 squares entirely at compile time, with the smallest one at the front.
+	constexpr FixedSList<int, 16> MakeSquaresTable()
+	{
+		FixedSList<int, 16> Table;
+
+		for (int i = 9; i >= 0; --i)
+		{
+			Table.push_front(i * i);
+		}
+
+		return Table;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr T SumOfList(const FixedSList<T, Capacity>& List)
+	{
+		T Sum = T();
+
+		for (auto It = List.cbegin(); It != List.cend(); ++It)
+		{
+			Sum += *It;
+		}
+
+		return Sum;
+	}
+
+	constexpr FixedSList<int, 16> CopyPopAndAssign()
+	{
+		FixedSList<int, 16> Copy = MakeSquaresTable();
+		Copy.pop_front();
+		Copy.pop_front();
+
+		FixedSList<int, 16> Other = { 1, 2, 3 };
+		Other.assign(2, 5);
+
+		Copy.push_front(Other.front());
+		return Copy;
+	}
 }
 
 
@@ -126,4 +165,24 @@ namespace FixedTests
 		A.assign({ 5.65f, 3.85f });
 		PrintList(A);
 	}
+
+	void TestConstexpr()
+	{
+		static constexpr FixedSList<int, 16> Squares = MakeSquaresTable();
+
+		static_assert(!Squares.empty(), "Squares table shouldn't be empty.");
+		static_assert(Squares.front() == 0, "The smallest square should be at the front.");
+		static_assert(SumOfList(Squares) == 285, "Sum of the first 10 squares should be 285.");
+
+		static constexpr FixedSList<int, 16> Mixed = CopyPopAndAssign();
+		static_assert(Mixed.front() == 5, "Front should be the value pushed after assign(2, 5).");
+		static_assert(SumOfList(Mixed) == 5 + 285 - 1, "Should hold 5 and the squares table without 0 and 1.");
+
+		static_assert(SumOfList(FixedSList<int, 4>(3, 7)) == 21, "assign(3, 7) should sum to 21.");
+		static_assert(FixedSList<int, 4>().empty(), "Default constructed list should be empty.");
+		static_assert(Squares.size() == 10 && Mixed.size() == 9, "size() should be usable during constant evaluation.");
+
+		PrintList(Squares);
+		PrintList(Mixed);
+	}
 }
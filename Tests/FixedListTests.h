@@ -10,4 +10,5 @@ namespace FixedTests
 	void TestSwap();
 	void TestAssignment();
 	void TestInitializationList();
+	void TestConstexpr();
 }
@@ -0,0 +1,85 @@
+// Alessandro Pegoraro - 2022
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+
+// The first SubBuckets values have a bucket each. Then, the values whose highest set bit is Magnitude are shifted right by
+// Shift = Magnitude - SubBucketBits + 1, keeping their top SubBucketBits - 1 bits below the highest one: HalfSubBuckets buckets per power of 2.
+LatencyHistogram::LatencyHistogram() : m_Buckets(SubBuckets + (64 - SubBucketBits) * HalfSubBuckets) { }
+
+std::size_t LatencyHistogram::BucketOf(std::uint64_t Nanoseconds)
+{
+	if (Nanoseconds < SubBuckets) return static_cast<std::size_t>(Nanoseconds);
+
+	const int Shift = std::bit_width(Nanoseconds) - SubBucketBits;
+	return static_cast<std::size_t>(SubBuckets + (Shift - 1) * HalfSubBuckets + ((Nanoseconds >> Shift) - HalfSubBuckets));
+}
+
+std::uint64_t LatencyHistogram::LowestValueOf(std::size_t Bucket)
+{
+	if (Bucket < SubBuckets) return Bucket;
+
+	const std::uint64_t Shift = (Bucket - SubBuckets) / HalfSubBuckets + 1;
+	return (HalfSubBuckets + (Bucket - SubBuckets) % HalfSubBuckets) << Shift;
+}
+
+
+
+void LatencyHistogram::Record(std::uint64_t Nanoseconds, std::uint64_t Allocations, std::uint64_t Deallocations)
+{
+	Bucket& Target = m_Buckets[BucketOf(Nanoseconds)];
+
+	++Target.Operations;
+	Target.Allocations += Allocations;
+	Target.Deallocations += Deallocations;
+
+	++m_Count;
+	m_Max = std::max(m_Max, Nanoseconds);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& That)
+{
+	for (std::size_t i = 0; i < m_Buckets.size(); ++i)
+	{
+		m_Buckets[i].Operations += That.m_Buckets[i].Operations;
+		m_Buckets[i].Allocations += That.m_Buckets[i].Allocations;
+		m_Buckets[i].Deallocations += That.m_Buckets[i].Deallocations;
+	}
+
+	m_Count += That.m_Count;
+	m_Max = std::max(m_Max, That.m_Max);
+}
+
+std::uint64_t LatencyHistogram::ValueAtPercentile(double Percentile) const
+{
+	if (m_Count == 0) return 0;
+
+	const std::uint64_t Rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(Percentile / 100.0 * m_Count)));
+	std::uint64_t Seen = 0;
+
+	for (std::size_t i = 0; i < m_Buckets.size(); ++i)
+	{
+		Seen += m_Buckets[i].Operations;
+		if (Seen >= Rank) return std::min(LowestValueOf(i), m_Max);
+	}
+
+	return m_Max;
+}
+
+auto LatencyHistogram::TailFrom(std::uint64_t Nanoseconds) const -> Tail
+{
+	Tail Result;
+
+	for (std::size_t i = BucketOf(Nanoseconds); i < m_Buckets.size(); ++i)
+	{
+		Result.Operations += m_Buckets[i].Operations;
+		Result.Allocations += m_Buckets[i].Allocations;
+		Result.Deallocations += m_Buckets[i].Deallocations;
+	}
+
+	return Result;
+}
@@ -0,0 +1,65 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * Histogram of latencies in nanoseconds, with the same log-linear layout as an HdrHistogram.
+ *
+ * Values below 256 have a bucket each. Above, every power of 2 is split into 128 buckets, so a bucket is never wider than 1/128 of its values:
+ * percentiles are accurate within 0.8%, from nanoseconds up to hours, in a few thousand buckets.
+ * Recording a value is a bit scan and an increment, cheap enough to time every single operation.
+ *
+ * Along with the number of operations, each bucket sums the allocations and deallocations they made, to tell which outliers come from the allocator.
+ */
+class LatencyHistogram final
+{
+public:
+
+	// Operations recorded at or above a given latency, along with the allocations they made.
+	struct Tail
+	{
+		std::uint64_t Operations = 0;
+		std::uint64_t Allocations = 0;
+		std::uint64_t Deallocations = 0;
+	};
+
+
+	LatencyHistogram();
+
+	void Record(std::uint64_t Nanoseconds, std::uint64_t Allocations, std::uint64_t Deallocations);
+	void Merge(const LatencyHistogram& That);
+
+	inline std::uint64_t Count() const { return m_Count; }
+	inline std::uint64_t Max() const { return m_Max; }
+
+	// The lowest latency which Percentile percent of the operations don't exceed, rounded down to its bucket.
+	std::uint64_t ValueAtPercentile(double Percentile) const;
+
+	// Sums the operations in the buckets from the one of Nanoseconds up.
+	Tail TailFrom(std::uint64_t Nanoseconds) const;
+
+private:
+
+	static constexpr int SubBucketBits = 8;
+	static constexpr std::uint64_t SubBuckets = std::uint64_t(1) << SubBucketBits;
+	static constexpr std::uint64_t HalfSubBuckets = SubBuckets / 2;
+
+	static std::size_t BucketOf(std::uint64_t Nanoseconds);
+	static std::uint64_t LowestValueOf(std::size_t Bucket);
+
+	struct Bucket
+	{
+		std::uint64_t Operations = 0;
+		std::uint64_t Allocations = 0;
+		std::uint64_t Deallocations = 0;
+	};
+
+	std::vector<Bucket> m_Buckets;
+	std::uint64_t m_Count = 0;
+	std::uint64_t m_Max = 0;
+};
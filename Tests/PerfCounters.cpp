@@ -0,0 +1,158 @@
+// Alessandro Pegoraro - 2022
+
+#include "PerfCounters.h"
+
+#ifdef __linux__
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace PerfCounters
+{
+	const char* EventName(Event CountedEvent)
+	{
+		switch (CountedEvent)
+		{
+		case Event::Cycles:          return "cycles";
+		case Event::Instructions:    return "instructions";
+		case Event::L1DLoadMisses:   return "L1D misses";
+		case Event::L1IMisses:       return "L1I misses";
+		case Event::LLCLoadMisses:   return "LLC misses";
+		case Event::DTLBLoadMisses:  return "dTLB misses";
+		case Event::BranchMisses:    return "branch misses";
+		}
+
+		return "unknown";
+	}
+
+
+#ifdef __linux__
+
+	namespace
+	{
+		constexpr std::uint64_t CacheLoadMisses(std::uint64_t Cache)
+		{
+			return Cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		}
+	}
+
+	Counter::Counter(Event CountedEvent)
+	{
+		perf_event_attr Attributes;
+		std::memset(&Attributes, 0, sizeof(Attributes));
+
+		Attributes.size = sizeof(Attributes);
+		Attributes.disabled = 1;
+		Attributes.exclude_kernel = 1;
+		Attributes.exclude_hv = 1;
+		Attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		switch (CountedEvent)
+		{
+		case Event::Cycles:
+			Attributes.type = PERF_TYPE_HARDWARE;
+			Attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+			break;
+		case Event::Instructions:
+			Attributes.type = PERF_TYPE_HARDWARE;
+			Attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+			break;
+		case Event::L1DLoadMisses:
+			Attributes.type = PERF_TYPE_HW_CACHE;
+			Attributes.config = CacheLoadMisses(PERF_COUNT_HW_CACHE_L1D);
+			break;
+		case Event::L1IMisses:
+			Attributes.type = PERF_TYPE_HW_CACHE;
+			Attributes.config = CacheLoadMisses(PERF_COUNT_HW_CACHE_L1I);
+			break;
+		case Event::LLCLoadMisses:
+			Attributes.type = PERF_TYPE_HW_CACHE;
+			Attributes.config = CacheLoadMisses(PERF_COUNT_HW_CACHE_LL);
+			break;
+		case Event::DTLBLoadMisses:
+			Attributes.type = PERF_TYPE_HW_CACHE;
+			Attributes.config = CacheLoadMisses(PERF_COUNT_HW_CACHE_DTLB);
+			break;
+		case Event::BranchMisses:
+			Attributes.type = PERF_TYPE_HARDWARE;
+			Attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+			break;
+		}
+
+		// Fails with -1 when the kernel, the CPU or the container doesn't allow the event: the counter then stays unavailable.
+		m_FileDescriptor = static_cast<int>(syscall(SYS_perf_event_open, &Attributes, 0, -1, -1, 0));
+	}
+
+	Counter::~Counter()
+	{
+		if (IsAvailable()) close(m_FileDescriptor);
+	}
+
+	void Counter::Start()
+	{
+		if (!IsAvailable()) return;
+
+		ioctl(m_FileDescriptor, PERF_EVENT_IOC_RESET, 0);
+		ioctl(m_FileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+	}
+
+	long long Counter::Stop()
+	{
+		if (!IsAvailable()) return -1;
+
+		ioctl(m_FileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+
+		// Value, time enabled and time running, as requested by read_format.
+		std::uint64_t Values[3] = { };
+		if (read(m_FileDescriptor, Values, sizeof(Values)) != sizeof(Values)) return -1;
+
+		if (Values[2] == 0) return -1;
+		if (Values[2] < Values[1]) return static_cast<long long>(static_cast<double>(Values[0]) * Values[1] / Values[2]);
+
+		return static_cast<long long>(Values[0]);
+	}
+
+#else
+
+	Counter::Counter(Event) { }
+	Counter::~Counter() = default;
+	void Counter::Start() { }
+	long long Counter::Stop() { return -1; }
+
+#endif
+
+
+	CounterSet::CounterSet()
+		: m_Counters{ Counter(Event::Cycles), Counter(Event::Instructions), Counter(Event::L1DLoadMisses), Counter(Event::L1IMisses),
+					  Counter(Event::LLCLoadMisses), Counter(Event::DTLBLoadMisses), Counter(Event::BranchMisses) } { }
+
+	bool CounterSet::IsAnyAvailable() const
+	{
+		for (const Counter& EventCounter : m_Counters)
+		{
+			if (EventCounter.IsAvailable()) return true;
+		}
+
+		return false;
+	}
+
+	void CounterSet::Start()
+	{
+		for (Counter& EventCounter : m_Counters) EventCounter.Start();
+	}
+
+	std::array<long long, NumberOfEvents> CounterSet::Stop()
+	{
+		std::array<long long, NumberOfEvents> Counts;
+
+		// Stopped in reverse order, so that the counters started first don't count the others' stops.
+		for (std::size_t i = NumberOfEvents; i > 0; --i) Counts[i - 1] = m_Counters[i - 1].Stop();
+
+		return Counts;
+	}
+}
@@ -0,0 +1,72 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+
+/**
+ * Hardware performance counters, read through perf_event_open on Linux.
+ * Where they aren't available, like on other systems or in containers forbidding perf events, counters report themselves as unavailable.
+ */
+namespace PerfCounters
+{
+	enum class Event
+	{
+		Cycles,
+		Instructions,
+		L1DLoadMisses,
+		L1IMisses,
+		LLCLoadMisses,
+		DTLBLoadMisses,
+		BranchMisses
+	};
+
+	constexpr std::size_t NumberOfEvents = 7;
+
+	const char* EventName(Event CountedEvent);
+
+
+	// Counts Event for the calling thread, between Start() and Stop().
+	class Counter final
+	{
+	public:
+
+		explicit Counter(Event CountedEvent);
+		~Counter();
+
+		Counter(const Counter&) = delete;
+		Counter& operator= (const Counter&) = delete;
+
+		inline bool IsAvailable() const { return m_FileDescriptor >= 0; }
+
+		void Start();
+		// Returns the events counted since Start(), or -1 if the counter is not available.
+		// If the kernel had to multiplex the counter with others, the count is scaled to the whole measured time.
+		long long Stop();
+
+	private:
+
+		int m_FileDescriptor = -1;
+	};
+
+
+	// Counts every Event at once, between Start() and Stop().
+	class CounterSet final
+	{
+	public:
+
+		CounterSet();
+
+		bool IsAnyAvailable() const;
+
+		void Start();
+		// Returns the count of each Event, in declaration order: unavailable events are -1.
+		std::array<long long, NumberOfEvents> Stop();
+
+	private:
+
+		std::array<Counter, NumberOfEvents> m_Counters;
+	};
+}
@@ -0,0 +1,134 @@
+// Alessandro Pegoraro - 2022
+
+#include "PersistentListTests.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "PersistentSList.h"
+
+
+namespace
+{
+	template<typename T>
+	void PrintList(const PersistentSList<T>& List)
+	{
+		int count = 0;
+
+		for (auto It = List.cbegin(); It != List.cend(); ++It)
+		{
+			++count;
+			std::cout << *It << " ";
+		}
+
+		std::cout << "Number Of Elements: " << count << "\n";
+	}
+}
+
+
+namespace PersistentTests
+{
+	void TestConstructorsAndFront()
+	{
+		PersistentSList<int> Empty;
+		PrintList(Empty);
+		std::cout << "Is empty? " << (Empty.empty() ? "Yep\n\n" : "Nope\n\n");
+
+		PersistentSList<int> Defaulted(4);
+		PrintList(Defaulted);
+
+		PersistentSList<float> Filled(3, 2.5f);
+		PrintList(Filled);
+
+		PersistentSList<int> FromIL = { 1, 2, 3, 4 };
+		PrintList(FromIL);
+		std::cout << "Front: " << FromIL.front() << "\n";
+
+		PersistentSList<int> Copy(FromIL);
+		std::cout << "Copy shares its nodes? " << (&Copy.front() == &FromIL.front() ? "Yep\n" : "Nope\n");
+
+		Copy = Defaulted;
+		PrintList(Copy);
+		PrintList(FromIL);
+
+		std::cout << "\n";
+	}
+
+	void TestPushPopVersions()
+	{
+		const PersistentSList<int> Original = { 3, 2, 1 };
+
+		PersistentSList<int> Pushed = Original.push_front(4).push_front(5);
+		PersistentSList<int> Popped = Original.pop_front();
+		PersistentSList<int> Branch = Popped.push_front(9);
+
+		std::cout << "Original...\n";
+		PrintList(Original);
+		std::cout << "Pushed 4 and 5...\n";
+		PrintList(Pushed);
+		std::cout << "Popped once...\n";
+		PrintList(Popped);
+		std::cout << "Popped once, then pushed 9...\n";
+		PrintList(Branch);
+
+		std::cout << "Pushed shares Original's nodes? " << (&*(++(++Pushed.cbegin())) == &Original.front() ? "Yep\n" : "Nope\n");
+
+		PersistentSList<int> Emptied = Original.pop_front().pop_front().pop_front().pop_front();
+		std::cout << "Popped more than its size, is empty? " << (Emptied.empty() ? "Yep\n" : "Nope\n");
+
+		Pushed.clear();
+		std::cout << "After clearing Pushed, Original is still...\n";
+		PrintList(Original);
+
+		std::cout << "\n";
+	}
+
+	void TestSnapshotsAcrossThreads()
+	{
+		PersistentSList<int> Shared(1000, 1);
+
+		constexpr int NumberOfThreads = 8;
+		std::vector<int> Sums(NumberOfThreads, 0);
+		std::vector<std::thread> Threads;
+
+		for (int i = 0; i < NumberOfThreads; ++i)
+		{
+			Threads.emplace_back([&Shared, &Sums, i]()
+			{
+				for (int Iteration = 0; Iteration < 1000; ++Iteration)
+				{
+					PersistentSList<int> Snapshot = Shared;
+					PersistentSList<int> Extended = Snapshot.push_front(i).push_front(i);
+					Sums[i] = Extended.front() + Extended.pop_front().front();
+				}
+
+				for (int Value : Shared) Sums[i] += Value;
+			});
+		}
+
+		for (std::thread& Thread : Threads) Thread.join();
+
+		for (int i = 0; i < NumberOfThreads; ++i)
+		{
+			std::cout << "Thread " << i << " sum: " << Sums[i] << "\n";
+		}
+
+		std::cout << "\n";
+	}
+
+	void TestLongChainDestruction()
+	{
+		PersistentSList<int> Long;
+
+		for (int i = 0; i < 1000000; ++i)
+		{
+			Long = Long.push_front(i);
+		}
+
+		PersistentSList<int> Snapshot = Long;
+		std::cout << "Built a list of 1000000 nodes, front: " << Snapshot.front() << "\n";
+
+		Long.clear();
+		Snapshot.clear();
+		std::cout << "Destroyed it without overflowing the stack.\n\n";
+	}
+}
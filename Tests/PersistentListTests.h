@@ -0,0 +1,12 @@
+// Alessandro Pegoraro - 2022
+
+#pragma once
+
+
+namespace PersistentTests
+{
+	void TestConstructorsAndFront();
+	void TestPushPopVersions();
+	void TestSnapshotsAcrossThreads();
+	void TestLongChainDestruction();
+}
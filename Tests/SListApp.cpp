@@ -2,15 +2,40 @@
 
 #include <iostream>
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <forward_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include "SList.h"
+#include "ArenaSList.h"
+#include "CompactSList.h"
+#include "SplitSList.h"
 #include "SListArray.h"
+#include "HugePageVector.h"
+#include "CowSListArray.h"
+#include "TombstoneSListArray.h"
+#include "ColumnarSListArray.h"
+#include "IndexedSList.h"
+#include "RcuSList.h"
+#include "ShardedSList.h"
 #include "FixedSList.h"
+#include "FrozenSList.h"
+#include "SListViews.h"
 #include "FixedListTests.h"
+#include "BoundedListTests.h"
+#include "PersistentListTests.h"
+#include "Benchmarks.h"
 
 
-template< template<typename _> class ListType, typename T>
-void PrintList(const ListType<T>& List)
+template<typename ListType>
+void PrintList(const ListType& List)
 {
 	int count = 0;
 
@@ -20,9 +45,22 @@ void PrintList(const ListType<T>& List)
 		std::cout << *It << " ";
 	}
 
-	std::cout << "Number Of Elements: " << count << "\n";
+	std::cout << "Number Of Elements: " << count << ", size(): " << List.size() << "\n";
 }
 
+// SplitSList, SListArray and IndexedSList have more template parameters, so they need an alias to be passed to the generic tests.
+template<typename T>
+using PlainSplitSList = SplitSList<T>;
+
+template<typename T>
+using VectorSListArray = SListArray<T>;
+
+template<typename T>
+using HugePageSListArray = SListArray<T, HugePageVector<T>>;
+
+template<typename T>
+using HashedIndexedSList = IndexedSList<T>;
+
 template< template<typename _> class ListType>
 ListType<int> ReturnListOfIntegers() { return ListType<int>(1, 8); }
 
@@ -140,6 +178,664 @@ void TestInitializationList()
 
 
 
+void TestPushBackAndAppend()
+{
+	SList<int> Queue;
+
+	for (int i = 1; i <= 4; ++i) Queue.push_back(i);
+	std::cout << "\nQueue after push_back 1, 2, 3, 4...\n";
+	PrintList(Queue);
+	std::cout << "Front: " << Queue.front() << ", Back: " << Queue.back() << "\n";
+
+	Queue.pop_front();
+	Queue.push_front(0);
+	Queue.push_back(5);
+	PrintList(Queue);
+
+	SList<int> Other = { 7, 6 };
+	Queue.append(std::move(Other));
+	std::cout << "After appending { 7, 6 }...\n";
+	PrintList(Queue);
+	std::cout << "Back: " << Queue.back() << ", Other is empty? " << (Other.empty() ? "Yep\n" : "Nope\n");
+
+	const int Values[] = { 4, 8, 15, 16, 23, 42 };
+	SList<int> FromRange(std::begin(Values), std::end(Values));
+	std::cout << "Constructed from a range, preserving its order...\n";
+	PrintList(FromRange);
+
+	FromRange.assign(Queue.cbegin(), Queue.cend());
+	std::cout << "Assigned from Queue's range...\n";
+	PrintList(FromRange);
+
+	while (!FromRange.empty()) FromRange.pop_front();
+	FromRange.push_back(9);
+	std::cout << "Emptied and pushed back 9, Front: " << FromRange.front() << ", Back: " << FromRange.back() << "\n";
+
+	SList<int> Moved(std::move(Queue));
+	Moved.push_back(10);
+	std::cout << "Moved Queue and pushed back 10...\n";
+	PrintList(Moved);
+	std::cout << "Queue is empty? " << (Queue.empty() ? "Yep\n" : "Nope\n");
+}
+
+
+void TestReverseAndSplice()
+{
+	SList<int> List = { 5, 4, 3, 2, 1 };
+	std::cout << "\nList...\n";
+	PrintList(List);
+
+	List.reverse();
+	std::cout << "Reversed, Front: " << List.front() << ", Back: " << List.back() << "\n";
+	PrintList(List);
+
+	List.insert_after(List.cbegin(), 10);
+	List.erase_after(std::next(List.cbegin(), 2));
+	std::cout << "After insert_after the front and erase_after the third...\n";
+	PrintList(List);
+
+	SList<int> Other = { 21, 20 };
+	List.splice_after(List.cbegin(), std::move(Other));
+	std::cout << "After splicing { 21, 20 } after the front...\n";
+	PrintList(List);
+
+	SList<int> Tail = { 31, 30 };
+	List.splice_after(std::next(List.cbegin(), List.size() - 1), std::move(Tail));
+	List.push_back(40);
+	std::cout << "After splicing { 31, 30 } after the back and pushing back 40, Back: " << List.back() << "\n";
+	PrintList(List);
+
+	SList<std::string> Strings = { "c", "b", "a" };
+	Strings.reverse();
+	Strings.erase_after(Strings.cbegin());
+	PrintList(Strings);
+}
+
+struct Session
+{
+	int Id;
+	int Priority;
+	char Name[56];
+};
+
+struct SessionId
+{
+	int operator() (const Session& S) const { return S.Id; }
+};
+
+void TestHotField()
+{
+	SplitSList<Session, SessionId> Sessions;
+
+	for (int i = 0; i < 10; ++i)
+	{
+		Sessions.push_front(Session{ i, i % 3, "session" });
+	}
+
+	auto Found = Sessions.find_if_hot([](int Id) { return Id == 4; });
+	std::cout << "\nSession found by its hot Id: " << Found->Id << ", priority " << Found->Priority << "\n";
+
+	std::cout << "Sessions with an even Id: " << Sessions.count_if_hot([](int Id) { return Id % 2 == 0; }) << "\n";
+
+	auto FoundBoth = Sessions.find_if([](int Id) { return Id > 2; }, [](const Session& S) { return S.Priority == 0; });
+	std::cout << "First session with Id > 2 and priority 0: " << FoundBoth->Id << "\n";
+
+	auto NotFound = Sessions.find_if_hot([](int Id) { return Id > 100; });
+	std::cout << "Session with Id > 100 found? " << (NotFound != Sessions.cend() ? "Yep\n" : "Nope\n");
+
+	Sessions.pop_front();
+	Sessions.pop_front();
+	std::cout << "After popping twice, front: " << Sessions.front().Id << ", third element: " << Sessions.nth(2)->Id << ", size(): " << Sessions.size() << "\n";
+
+	SplitSList<Session, SessionId> Copy(Sessions);
+	std::cout << "Copy's hot Ids: ";
+	for (auto It = Copy.cbegin(); It != Copy.cend(); ++It) std::cout << It.link().Hot << " ";
+	std::cout << "\n";
+}
+
+
+void TestCopyOnWrite()
+{
+	CowSListArray<int> Original = { 1, 2, 3 };
+	const CowSListArray<int> Reader(Original);
+
+	auto SharesBuffer = [](const CowSListArray<int>& A, const CowSListArray<int>& B) { return &*A.cbegin() == &*B.cbegin(); };
+
+	std::cout << "\nCopy shares the buffer? " << (SharesBuffer(Original, Reader) ? "Yep\n" : "Nope\n");
+
+	int Sum = 0;
+	for (auto It = Reader.cbegin(); It != Reader.cend(); ++It) Sum += *It;
+	std::cout << "Sum read through the copy: " << Sum << ", still shared? " << (SharesBuffer(Original, Reader) ? "Yep\n" : "Nope\n");
+
+	Original.push_front(4);
+	std::cout << "After push_front on the original, still shared? " << (SharesBuffer(Original, Reader) ? "Yep\n" : "Nope\n");
+	PrintList(Original);
+	PrintList(Reader);
+
+	CowSListArray<int> Writer(Reader);
+	Writer.front() = 30;
+	std::cout << "After writing through front(), still shared? " << (SharesBuffer(Writer, Reader) ? "Yep\n" : "Nope\n");
+	PrintList(Writer);
+	PrintList(Reader);
+
+	// Writer handed out a reference to its buffer, so its copies don't share it: writing through the reference leaves them alone.
+	int& Front = Writer.front();
+	const CowSListArray<int> Snapshot(Writer);
+	Front = 300;
+	std::cout << "After writing through a reference taken before copying, the copy's front: " << Snapshot.front() << ", shared? "
+			  << (SharesBuffer(Writer, Snapshot) ? "Yep\n" : "Nope\n");
+}
+
+
+
+
+void TestRcuSList()
+{
+	RcuSList<int> List = { 1, 2, 3 };
+	const RcuSList<int>::Reader MainReader = List.make_reader();
+
+	auto PrintRcuList = [&]()
+	{
+		const auto Lock = MainReader.lock();
+		for (int Value : List) std::cout << Value << " ";
+		std::cout << "\n";
+	};
+
+	PrintRcuList();
+
+	List.push_front(4);
+	List.replace_front(40);
+	List.insert_after(List.cbegin(), 35);
+	List.erase_after(++List.cbegin());
+	List.replace_after(List.cbegin(), 30);
+	PrintRcuList();
+
+	List.pop_front();
+	List.synchronize();
+	PrintRcuList();
+
+	// Readers traverse while the writer keeps replacing values: the length of the list never changes, and no value is ever torn.
+	constexpr int Elements = 100;
+	List.clear();
+	for (int i = 0; i < Elements; ++i) List.push_front(0);
+
+	std::atomic<bool> Stop = false;
+	std::atomic<bool> AlwaysConsistent = true;
+	std::vector<std::thread> Readers;
+
+	for (int i = 0; i < 3; ++i)
+	{
+		Readers.emplace_back([&]()
+		{
+			const RcuSList<int>::Reader ThreadReader = List.make_reader();
+
+			while (!Stop.load())
+			{
+				const auto Lock = ThreadReader.lock();
+
+				int Count = 0;
+				for (auto It = List.cbegin(); It != List.cend(); ++It)
+				{
+					if (*It < 0) AlwaysConsistent = false;
+					++Count;
+				}
+
+				if (Count != Elements) AlwaysConsistent = false;
+			}
+		});
+	}
+
+	for (int Round = 1; Round <= 2000; ++Round)
+	{
+		List.replace_front(Round);
+		List.replace_after(List.cbegin(), Round);
+		List.replace_after(++List.cbegin(), Round);
+	}
+
+	Stop = true;
+	for (std::thread& Reader : Readers) Reader.join();
+
+	std::cout << "Readers always saw " << Elements << " valid elements? " << (AlwaysConsistent ? "Yep\n" : "Nope\n");
+	std::cout << "Front after the writes: " << List.front() << "\n";
+}
+
+
+
+
+void TestShardedSList()
+{
+	ShardedSList<int> List(4);
+	std::vector<std::thread> Pushers;
+
+	for (int Thread = 0; Thread < 4; ++Thread)
+	{
+		Pushers.emplace_back([&List, Thread]()
+		{
+			for (int i = 1; i <= 1000; ++i) List.push_front(Thread * 1000 + i);
+		});
+	}
+
+	for (std::thread& Pusher : Pushers) Pusher.join();
+
+	long long Sum = 0;
+	int Count = 0;
+	for (int Value : List)
+	{
+		Sum += Value;
+		++Count;
+	}
+
+	std::cout << "Shards: " << List.shard_count() << ", size(): " << List.size() << ", elements in the merged view: " << Count << ", sum: " << Sum << "\n";
+
+	const SList<int> Drained = List.drain();
+	std::cout << "Drained " << Drained.size() << " elements, is the sharded list empty now? " << (List.empty() ? "Yep\n" : "Nope\n");
+
+	List.push_front(42);
+	PrintList(List);
+	List.clear();
+	PrintList(List);
+
+	List.push_front(7);
+	ShardedSList<int> Moved = std::move(List);
+	std::cout << "Moved-from shards: " << List.shard_count() << ", size(): " << List.size() << ", empty? " << (List.empty() && List.begin() == List.end() ? "Yep" : "Nope");
+	std::cout << ", moved-to size(): " << Moved.size() << "\n";
+
+	List = std::move(Moved);
+	List.push_front(8);
+	PrintList(List);
+}
+
+
+
+
+void TestHugePageGrowth()
+{
+	// Ints are relocated by mremap, strings are moved one by one: both must survive several growths of the buffer.
+	SListArray<int, HugePageVector<int, true>> Numbers;
+	SListArray<std::string, HugePageVector<std::string>> Strings;
+
+	long long ExpectedSum = 0;
+	for (int i = 0; i < 2000000; ++i)
+	{
+		Numbers.push_front(i);
+		ExpectedSum += i;
+	}
+
+	for (int i = 0; i < 200000; ++i) Strings.push_front(std::to_string(i));
+
+	long long Sum = 0;
+	for (int Value : Numbers) Sum += Value;
+
+	std::cout << "\nNumbers: " << Numbers.size() << " elements, front: " << Numbers.front() << ", sum as expected? " << (Sum == ExpectedSum ? "Yep\n" : "Nope\n");
+	std::cout << "Strings: " << Strings.size() << " elements, front: " << Strings.front() << ", last: " << *std::next(Strings.cbegin(), 199999) << "\n";
+
+	const SListArray<std::string, HugePageVector<std::string>> StringsCopy(Strings);
+	std::cout << "Copy equal to the original? " << (std::equal(Strings.cbegin(), Strings.cend(), StringsCopy.cbegin()) ? "Yep\n" : "Nope\n");
+
+	// Two ints are a count and a value, not a range.
+	HugePageVector<int> Fives;
+	Fives.assign(3, 5);
+	std::cout << "Assigned 3 fives, size(): " << Fives.size() << ", back: " << Fives.back() << "\n";
+}
+
+void TestPackedLists()
+{
+	enum class Direction : unsigned char { North, East, South, West };
+
+	// SListArray<bool> and FixedSList<bool> are packed, one bit per flag.
+	SListArray<bool> Flags;
+	FixedSList<bool, 200> FixedFlags;
+
+	for (int i = 0; i < 150; ++i)
+	{
+		Flags.push_front(i % 3 == 0);
+		FixedFlags.push_front(i % 3 == 0);
+	}
+
+	std::cout << "\nFlags: " << Flags.size() << " elements, " << Flags.count(true) << " set, as std::count says? "
+			  << (Flags.count(true) == static_cast<std::size_t>(std::count(Flags.cbegin(), Flags.cend(), true)) ? "Yep\n" : "Nope\n");
+	std::cout << "FixedFlags: " << FixedFlags.size() << " elements, " << FixedFlags.count(true) << " set, equal to Flags? "
+			  << (std::equal(Flags.cbegin(), Flags.cend(), FixedFlags.cbegin()) ? "Yep\n" : "Nope\n");
+
+	// Elements are modified through proxy references.
+	for (auto It = Flags.begin(); It != Flags.end(); ++It) *It = !*It;
+	Flags.front() = true;
+
+	std::cout << "Flags after flipping them all and setting the front: " << Flags.count(true) << " set, front: " << Flags.front() << "\n";
+	std::cout << "First unset flag found at position: " << std::distance(Flags.begin(), Flags.find(false)) << "\n";
+
+	// Two bits per direction.
+	PackedSListArray<Direction, 2> Path = { Direction::North, Direction::East, Direction::South, Direction::West, Direction::North };
+	Path.push_front(Direction::South);
+
+	std::cout << "Printing values of Path...\n";
+	for (Direction Step : Path)
+	{
+		std::cout << static_cast<int>(Step) << ' ';
+	}
+	std::cout << "\nPath has " << Path.count(Direction::North) << " steps North, is West found? " << (Path.find(Direction::West) != Path.end() ? "Yep\n" : "Nope\n");
+}
+
+void TestFrozenSList()
+{
+	// Slowly increasing timestamps, with the latest at the front, and a short list with negative differences.
+	SListArray<long long> Timestamps;
+	for (long long i = 0; i < 100000; ++i) Timestamps.push_front(1650000000000 + i * 3 + i % 5);
+
+	SList<int> NodeList = { 42, 23, 16, 15, 8, 4 };
+
+	const FrozenSList<long long> FrozenTimestamps = freeze(Timestamps);
+	const FrozenSList<int> FrozenNodeList = freeze(NodeList);
+
+	std::cout << "\nFrozenTimestamps: " << FrozenTimestamps.size() << " elements, front: " << FrozenTimestamps.front() << ", equal to Timestamps? "
+			  << (std::equal(Timestamps.cbegin(), Timestamps.cend(), FrozenTimestamps.cbegin(), FrozenTimestamps.cend()) ? "Yep\n" : "Nope\n");
+	std::cout << "Timestamps take " << Timestamps.size() * sizeof(long long) << " bytes, FrozenTimestamps " << FrozenTimestamps.memory_usage() << " bytes.\n";
+
+	long long Sum = 0;
+	FrozenTimestamps.for_each([&Sum](long long Value) { Sum += Value; });
+	std::cout << "Sum through for_each equal to std::accumulate? "
+			  << (Sum == std::accumulate(FrozenTimestamps.cbegin(), FrozenTimestamps.cend(), 0LL) ? "Yep\n" : "Nope\n");
+
+	std::cout << "Printing values of FrozenNodeList...\n";
+	PrintList(FrozenNodeList);
+
+	const FrozenSList<int> FrozenEmpty = freeze(SList<int>());
+	PrintList(FrozenEmpty);
+
+	// A moved-from list is left empty, and still iterable.
+	FrozenSList<int> Source = freeze(SListArray<int>{ 5, 4, 3, 2, 1 });
+	FrozenSList<int> Moved(std::move(Source));
+	int Visited = 0;
+	Source.for_each([&Visited](int) { ++Visited; });
+	std::cout << "Moved-from list, size(): " << Source.size() << ", empty? " << (Source.empty() ? "Yep" : "Nope")
+			  << ", elements visited: " << std::distance(Source.cbegin(), Source.cend()) + Visited << "\n";
+	PrintList(Moved);
+
+	Moved = freeze(NodeList);
+	Source = std::move(Moved);
+	std::cout << "Moved back and forth, Moved's size(): " << Moved.size() << ", Source's front: " << Source.front() << "\n";
+}
+
+void TestTombstoneErase()
+{
+	TombstoneSListArray<int> List;
+	for (int i = 20; i > 0; --i) List.push_front(i);
+
+	// Erases every multiple of 3, without ever compacting.
+	List.set_max_tombstone_ratio(1.0);
+	for (auto It = List.begin(); It != List.end(); )
+	{
+		if (*It % 3 == 0) It = List.erase(It);
+		else ++It;
+	}
+
+	std::cout << "\nPrinting List, without the multiples of 3...\n";
+	PrintList(List);
+	std::cout << "Tombstones: " << List.tombstone_count() << "\n";
+
+	// The front is never a tombstone: erasing it pops it, along with the tombstones right behind it.
+	List.erase(List.cbegin());
+	List.erase(List.cbegin());
+	std::cout << "Front after erasing the first two values: " << List.front() << ", tombstones: " << List.tombstone_count() << "\n";
+
+	// Crossing the ratio compacts the vector, removing all the tombstones in one pass.
+	List.set_max_tombstone_ratio(0.25);
+	auto Next = List.erase(std::next(List.cbegin(), 3));
+
+	std::cout << "After crossing the ratio, tombstones: " << List.tombstone_count() << ", value following the erased one: " << *Next << "\n";
+	PrintList(List);
+}
+
+void TestColumnarSListArray()
+{
+	ColumnarSListArray<int, std::string, double> List = { { 3, "three", 3.5 }, { 2, "two", 2.5 } };
+	List.push_front({ 1, "one", 1.5 });
+	List.push_front(0, "zero", 0.5);
+
+	std::cout << "\nPrinting the records of a ColumnarSListArray...\n";
+	for (auto [Id, Name, Weight] : List) std::cout << Id << ' ' << Name << ' ' << Weight << "\n";
+
+	// Writing through the proxy, then through a column.
+	for (auto [Id, Name, Weight] : List) Weight *= 2;
+	List.column<0>()[0] = 30;
+
+	// The column is in storage order: reversed, it walks the list from its front.
+	auto Weights = List.column<2>();
+	std::cout << "Summing the weights column alone: " << std::accumulate(Weights.begin(), Weights.end(), 0.0) << "\n";
+	std::cout << "Ids in list order: ";
+	for (int Id : List.column<0>() | std::views::reverse) std::cout << Id << ' ';
+
+	List.pop_front();
+	std::cout << "\nFront after popping: " << std::get<1>(List.front()) << ", size: " << List.size() << "\n";
+
+	// bool fields get a column of bytes, which can be viewed as a span just like the others.
+	ColumnarSListArray<int, bool> Flags = { { 4, true }, { 3, false }, { 2, true } };
+	Flags.push_front(1, false);
+	for (auto [Id, Active] : Flags) Active = !Active;
+
+	const std::span<bool> Active = Flags.column<1>();
+	std::cout << "Active flags after flipping them: " << std::count(Active.begin(), Active.end(), true) << " of " << Flags.size()
+			  << ", front active? " << (std::get<1>(Flags.front()) ? "Yep\n" : "Nope\n");
+}
+
+void TestIndexedSList()
+{
+	IndexedSList<std::string> Sessions = { "carol", "bob", "alice" };
+	Sessions.push_front("dave");
+
+	std::cout << "\nPrinting Sessions...\n";
+	PrintList(Sessions);
+
+	// Values are unique: pushing one already in the list leaves it unchanged.
+	std::cout << "Pushing bob again? " << (Sessions.push_front("bob") ? "Pushed\n" : "Already there\n");
+	std::cout << "Contains carol? " << (Sessions.contains("carol") ? "Yep" : "Nope") << ", contains erin? " << (Sessions.contains("erin") ? "Yep\n" : "Nope\n");
+	std::cout << "Value following bob: " << *std::next(Sessions.find("bob")) << "\n";
+
+	// Erasing from the middle, then the back, then the front, each time updating the predecessor of the following value.
+	std::cout << "Erased bob: " << Sessions.erase("bob") << ", erased erin: " << Sessions.erase("erin") << "\n";
+	Sessions.erase("carol");
+	Sessions.erase("dave");
+	Sessions.push_back("frank");
+	std::cout << "After erasing carol and dave, and pushing back frank...\n";
+	PrintList(Sessions);
+
+	Sessions.pop_front();
+	Sessions.push_front("grace");
+	IndexedSList<std::string> Copy(Sessions);
+	Copy.erase("frank");
+	std::cout << "Copy, without frank, contains grace? " << (Copy.contains("grace") ? "Yep\n" : "Nope\n");
+	PrintList(Copy);
+	PrintList(Sessions);
+
+	IndexedSList<std::string> Empty;
+	Empty.pop_front();
+	Sessions.pop_front();
+	Sessions.pop_front();
+	Sessions.pop_front();
+	std::cout << "After popping from an empty list, and past the end of Sessions, are both empty? " << (Empty.empty() && Sessions.empty() ? "Yep\n" : "Nope\n");
+}
+
+void TestBatchPushPop()
+{
+	const int Burst[] = { 1, 2, 3, 4, 5 };
+
+	SList<int> NodeList = { 7, 6 };
+	NodeList.push_front_range(std::begin(Burst), std::end(Burst));
+	NodeList.push_front_n(2, 0);
+	std::cout << "\nSList after pushing { 1, 2, 3, 4, 5 } and two 0s to the front...\n";
+	PrintList(NodeList);
+
+	std::vector<int> Drained;
+	NodeList.pop_front_n(4, std::back_inserter(Drained));
+	std::cout << "Popped 4 values into a vector: ";
+	for (int Value : Drained) std::cout << Value << ' ';
+	std::cout << "\n";
+
+	// The popped nodes are detached as a list of their own, without copying them.
+	SList<int> Detached = NodeList.pop_front_n(3);
+	std::cout << "Detached the next 3 nodes, Back: " << Detached.back() << "\n";
+	PrintList(Detached);
+	PrintList(NodeList);
+
+	SListArray<int> VectorList = { 7, 6 };
+	VectorList.push_front_range(std::begin(Burst), std::end(Burst));
+	VectorList.push_front_n(2, 0);
+	std::cout << "SListArray after the same pushes...\n";
+	PrintList(VectorList);
+
+	Drained.clear();
+	VectorList.pop_front_n(20, std::back_inserter(Drained));
+	std::cout << "Popped at most 20 values, " << Drained.size() << " of them, is empty? " << (VectorList.empty() ? "Yep\n" : "Nope\n");
+
+	// SListArray<bool> is packed, and offers the same batch operations: compared against pushing one flag at a time.
+	std::vector<bool> Bits;
+	for (int i = 0; i < 150; ++i) Bits.push_back(i % 5 < 2);
+
+	SListArray<bool> Flags = { true, false, true };
+	SListArray<bool> Expected = Flags;
+	Flags.push_front_range(Bits.cbegin(), Bits.cend());
+	Flags.push_front_n(70, true);
+	for (auto Bit = Bits.crbegin(); Bit != Bits.crend(); ++Bit) Expected.push_front(*Bit);
+	for (int i = 0; i < 70; ++i) Expected.push_front(true);
+	std::cout << "SListArray<bool> after pushing 150 flags and 70 set ones, " << Flags.size() << " flags, as pushed one by one? "
+			  << (std::equal(Flags.cbegin(), Flags.cend(), Expected.cbegin(), Expected.cend()) ? "Yep\n" : "Nope\n");
+
+	std::vector<bool> PoppedFlags;
+	Flags.pop_front_n(72, std::back_inserter(PoppedFlags));
+	std::cout << "Popped " << PoppedFlags.size() << " flags, " << std::count(PoppedFlags.begin(), PoppedFlags.end(), true) << " set, front now: " << Flags.front() << "\n";
+
+	// Single pass ranges are packed in their order, then reversed.
+	std::istringstream Codes("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 0 1 2");
+	PackedSListArray<unsigned char, 4> Nibbles = { 9 };
+	Nibbles.push_front_range(std::istream_iterator<int>(Codes), std::istream_iterator<int>());
+	std::cout << "Nibbles from a stream: ";
+	for (auto It = Nibbles.cbegin(); It != Nibbles.cend(); ++It) std::cout << static_cast<int>(*It) << ' ';
+	std::cout << "\n";
+
+	std::vector<SListArray<bool>> FlagLists = { { true, true, false }, { true, false, false, false } };
+	SListArray<bool> MergedFlags = { true, false };
+	MergedFlags.merge(FlagLists);
+	std::cout << "Merged flags, " << MergedFlags.size() << " of them, " << MergedFlags.count(false) << " unset first? "
+			  << (std::is_sorted(MergedFlags.cbegin(), MergedFlags.cend()) ? "Yep\n" : "Nope\n");
+}
+
+// Destroyed after the reclaimer has been shut down at exit, since it's constructed before the reclaimer is started.
+SList<int> StaticDeferredList;
+
+void TestDeferredDestruction()
+{
+	SList<int> List;
+	List.set_deferred_destruction(true);
+	for (int i = 0; i < 100000; ++i) List.push_front(i);
+
+	// Returns right away: the nodes are destroyed by the reclaimer's thread.
+	List.clear();
+	std::cout << "\nCleared a list of 100000 nodes in deferred mode, is empty? " << (List.empty() ? "Yep\n" : "Nope\n");
+
+	{
+		SList<int> Copy = { 3, 2, 1 };
+		for (int i = 0; i < 5000; ++i) Copy.push_front(i);
+		Copy.set_deferred_destruction(true);
+	}
+
+	SListReclaimer::Instance().Flush();
+	std::cout << "After destroying another one and flushing, chains still pending: " << SListReclaimer::Instance().Pending() << "\n";
+
+	// The list stays usable, and short chains are destroyed synchronously.
+	List = { 7, 8, 9 };
+	PrintList(List);
+	std::cout << "Still in deferred mode? " << (List.deferred_destruction() ? "Yep\n" : "Nope\n");
+
+	// Its chain is destroyed synchronously at exit, once the reclaimer has stopped.
+	StaticDeferredList.set_deferred_destruction(true);
+	for (int i = 0; i < 5000; ++i) StaticDeferredList.push_front(i);
+	std::cout << "Static list in deferred mode, size(): " << StaticDeferredList.size() << "\n";
+}
+
+void TestMerge()
+{
+	std::vector<SList<int>> NodeLists = { { 9, 5, 1 }, { 8, 6, 2 }, { 7, 3 }, { } };
+	SList<int> Merged = { 4 };
+
+	// Only relinks the nodes, leaving the merged lists empty.
+	Merged.merge(NodeLists);
+	std::cout << "\nPrinting the merged SLists...\n";
+	PrintList(Merged);
+	std::cout << "First merged list is empty? " << (NodeLists[0].empty() ? "Yep\n" : "Nope\n");
+
+	SList<int> Descending = { 1, 4, 10 };
+	Merged.reverse();
+	Merged.merge(std::move(Descending), std::greater<int>());
+	std::cout << "Reversed, then merged with { 10, 4, 1 } in descending order...\n";
+	PrintList(Merged);
+
+	// A comparison throwing halfway through keeps every node in the list, the merged ones first.
+	SList<int> Throwing = { 11, 3, 0 };
+	int Comparisons = 0;
+	try
+	{
+		Merged.merge(std::move(Throwing), [&Comparisons](int A, int B)
+		{
+			if (++Comparisons == 5) throw std::runtime_error("Comparison failed");
+			return A > B;
+		});
+	}
+	catch (const std::runtime_error&)
+	{
+		std::cout << "Merge threw, nodes kept: " << Merged.size() << ", other list empty? " << (Throwing.empty() ? "Yep\n" : "Nope\n");
+	}
+
+	// Big enough to be split among 4 threads: each list holds the multiples of 4 plus its index, so every value appears once.
+	std::vector<SListArray<int>> VectorLists(4);
+	for (int i = 0; i < 4; ++i)
+	{
+		for (int Value = 4 * 100000 + i; Value >= 0; Value -= 4) VectorLists[i].push_front(Value);
+	}
+
+	SListArray<int> VectorMerged;
+	VectorMerged.merge(VectorLists, std::less<int>(), 4);
+
+	int Expected = 0;
+	const bool Sorted = std::all_of(VectorMerged.cbegin(), VectorMerged.cend(), [&Expected](int Value) { return Value == Expected++; });
+	std::cout << "Merged SListArrays in 4 threads, size(): " << VectorMerged.size() << ", holding 0 to " << Expected - 1 << " in order? " << (Sorted ? "Yep\n" : "Nope\n");
+
+	// The elements are moved into the merged list, never default constructed.
+	struct Ticket
+	{
+		explicit Ticket(int _Number) : Number(_Number) { }
+		int Number;
+	};
+
+	auto Earlier = [](const Ticket& A, const Ticket& B) { return A.Number < B.Number; };
+
+	std::vector<SListArray<Ticket>> TicketLists(2);
+	for (int Number = 2 * 100000; Number >= 0; Number -= 2) TicketLists[0].push_front(Ticket(Number));
+	for (int Number = 2 * 100000 + 1; Number >= 1; Number -= 2) TicketLists[1].push_front(Ticket(Number));
+
+	SListArray<Ticket> Tickets;
+	Tickets.push_front(Ticket(-1));
+	Tickets.merge(TicketLists, Earlier, 4);
+	std::cout << "Merged Tickets, without a default constructor, size(): " << Tickets.size() << ", front: " << Tickets.front().Number << "\n";
+
+	// A comparison throwing in one of the threads is rethrown once they've all been joined.
+	std::atomic<int> TicketComparisons = 0;
+	SListArray<Ticket> Others = Tickets;
+	try
+	{
+		Tickets.merge(std::span<SListArray<Ticket>>(&Others, 1), [&TicketComparisons, &Earlier](const Ticket& A, const Ticket& B)
+		{
+			if (++TicketComparisons == 300000) throw std::runtime_error("Comparison failed");
+			return Earlier(A, B);
+		}, 4);
+	}
+	catch (const std::runtime_error&)
+	{
+		std::cout << "Threaded merge threw, sizes kept? " << (Tickets.size() == Others.size() ? "Yep\n" : "Nope\n");
+	}
+}
+
+
+
 
 void TestFindIf()
 {
@@ -297,9 +993,83 @@ void TestCopy()
 	std::cout << "\n";
 }
 
+void TestViews()
+{
+	SList<int> NodeList             = { 42, 23, 16, 15, 8, 4 };
+	SListArray<int> VectorList      = { 42, 23, 16, 15, 8, 4 };
+	FixedSList<int, 20> FixedList   = { 42, 23, 16, 15, 8, 4 };
+
+	auto IsEven = [](int Value) { return Value % 2 == 0; };
+	auto Square = [](int Value) { return Value * Value; };
+
+	// Expected: 16, 64, 256, from the front of each list.
+	// filter_view caches its begin(), so views holding one can only be iterated when non const.
+	auto SquaredEvens = SListViews::all(NodeList) | SListViews::filter(IsEven) | SListViews::transform(Square) | SListViews::take(3);
+
+	std::cout << "Printing the first three squared evens of NodeList...\n";
+	for (int Value : SquaredEvens)
+	{
+		std::cout << Value << ' ';
+	}
+	std::cout << "\n";
+
+	std::cout << "Printing them materialized from VectorList into a SListArray...\n";
+	PrintList(SListViews::to<SListArray<int>>(VectorList | SListViews::filter(IsEven) | SListViews::transform(Square) | SListViews::take(3)));
+
+	std::cout << "Printing FixedList without its first two values, materialized into a FixedSList...\n";
+	PrintList(SListViews::to<FixedSList<int, 20>>(SListViews::all(FixedList) | SListViews::drop(2)));
+
+	// The pairs hold references, so the zipped lists can be modified through them.
+	for (auto [NodeValue, VectorValue] : SListViews::zip(NodeList, VectorList | SListViews::take(4)))
+	{
+		NodeValue += VectorValue;
+	}
+
+	std::cout << "Printing NodeList, after adding the first four values of VectorList to it...\n";
+	PrintList(NodeList);
+
+	std::cout << "Printing NodeList and FixedList zipped, summed and materialized into a SList...\n";
+	PrintList(SListViews::to<SList<int>>(SListViews::zip(SListViews::all(NodeList), SListViews::all(FixedList))
+		| SListViews::transform([](const auto& Pair) { return Pair.first + Pair.second; })));
+}
+
 
-int main()
+int main(int argc, char* argv[])
 {
+	// Benchmarks take a while, so they only run when explicitly requested.
+	if (argc > 1 && std::strcmp(argv[1], "--bench") == 0)
+	{
+		Benchmarks::BenchmarkBulkCopyAndAssign();
+		Benchmarks::BenchmarkArenaSList();
+		Benchmarks::BenchmarkPersistentSnapshots();
+		Benchmarks::BenchmarkCopyOnWrite();
+		Benchmarks::BenchmarkCompactSList();
+		Benchmarks::BenchmarkSplitSList();
+		Benchmarks::BenchmarkRcuSList();
+		Benchmarks::BenchmarkShardedSList();
+		Benchmarks::BenchmarkHugePages();
+		Benchmarks::BenchmarkHardwareCounters();
+		Benchmarks::BenchmarkSListInstantiations();
+		Benchmarks::BenchmarkViews();
+		Benchmarks::BenchmarkPackedLists();
+		Benchmarks::BenchmarkFrozenSList();
+		Benchmarks::BenchmarkTombstoneErase();
+		Benchmarks::BenchmarkIndexedSList();
+		Benchmarks::BenchmarkMerge();
+		Benchmarks::BenchmarkBatchPushPop();
+		Benchmarks::BenchmarkColumnar();
+		Benchmarks::BenchmarkDeferredDestruction();
+		return 0;
+	}
+
+	// Latency distributions load every hardware thread, so they run on their own: --latency [threads]
+	if (argc > 1 && std::strcmp(argv[1], "--latency") == 0)
+	{
+		const int Threads = argc > 2 ? std::atoi(argv[2]) : 0;
+		Benchmarks::BenchmarkTailLatency(Threads > 0 ? static_cast<unsigned int>(Threads) : std::max(1u, std::thread::hardware_concurrency()));
+		return 0;
+	}
+
 	TestPushPopClearAndFront<SList>();
 	TestConstructors<SList>();
 	TestSwap<SList>();
@@ -308,11 +1078,85 @@ int main()
 
 	std::cout << "\n\n=====================================================================\n\n";
 
-	TestPushPopClearAndFront<SListArray>();
-	TestConstructors<SListArray>();
-	TestSwap<SListArray>();
-	TestAssignment<SListArray>();
-	TestInitializationList<SListArray>();
+	TestPushPopClearAndFront<CompactSList>();
+	TestConstructors<CompactSList>();
+	TestSwap<CompactSList>();
+	TestAssignment<CompactSList>();
+	TestInitializationList<CompactSList>();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestPushPopClearAndFront<PlainSplitSList>();
+	TestConstructors<PlainSplitSList>();
+	TestSwap<PlainSplitSList>();
+	TestAssignment<PlainSplitSList>();
+	TestInitializationList<PlainSplitSList>();
+	TestHotField();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestPushPopClearAndFront<VectorSListArray>();
+	TestConstructors<VectorSListArray>();
+	TestSwap<VectorSListArray>();
+	TestAssignment<VectorSListArray>();
+	TestInitializationList<VectorSListArray>();
+
+	TestPushBackAndAppend();
+	TestReverseAndSplice();
+	TestMerge();
+	TestBatchPushPop();
+	TestDeferredDestruction();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestPushPopClearAndFront<HugePageSListArray>();
+	TestConstructors<HugePageSListArray>();
+	TestSwap<HugePageSListArray>();
+	TestAssignment<HugePageSListArray>();
+	TestInitializationList<HugePageSListArray>();
+	TestHugePageGrowth();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestPackedLists();
+	TestFrozenSList();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestPushPopClearAndFront<ArenaSList>();
+	TestConstructors<ArenaSList>();
+	TestSwap<ArenaSList>();
+	TestAssignment<ArenaSList>();
+	TestInitializationList<ArenaSList>();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestPushPopClearAndFront<CowSListArray>();
+	TestConstructors<CowSListArray>();
+	TestSwap<CowSListArray>();
+	TestAssignment<CowSListArray>();
+	TestInitializationList<CowSListArray>();
+	TestCopyOnWrite();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestPushPopClearAndFront<TombstoneSListArray>();
+	TestConstructors<TombstoneSListArray>();
+	TestSwap<TombstoneSListArray>();
+	TestAssignment<TombstoneSListArray>();
+	TestInitializationList<TombstoneSListArray>();
+	TestTombstoneErase();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestColumnarSListArray();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	// The other generic tests fill the lists with repeated values, which IndexedSList keeps only once.
+	TestPushPopClearAndFront<HashedIndexedSList>();
+	TestInitializationList<HashedIndexedSList>();
+	TestIndexedSList();
 
 	std::cout << "\n\n=====================================================================\n\n";
 
@@ -321,6 +1165,27 @@ int main()
 	FixedTests::TestSwap();
 	FixedTests::TestAssignment();
 	FixedTests::TestInitializationList();
+	FixedTests::TestConstexpr();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	BoundedTests::TestPushPopClearAndFront();
+	BoundedTests::TestConstructors();
+	BoundedTests::TestSwap();
+	BoundedTests::TestAssignment();
+	BoundedTests::TestInitializationList();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	PersistentTests::TestConstructorsAndFront();
+	PersistentTests::TestPushPopVersions();
+	PersistentTests::TestSnapshotsAcrossThreads();
+	PersistentTests::TestLongChainDestruction();
+
+	std::cout << "\n\n=====================================================================\n\n";
+
+	TestRcuSList();
+	TestShardedSList();
 
 	std::cout << "\n\n=====================================================================\n\n";
 
@@ -328,4 +1193,5 @@ int main()
 	TestCount();
 	TestForEachAndForRange();
 	TestCopy();
+	TestViews();
 }